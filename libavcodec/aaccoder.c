@@ -112,6 +112,24 @@ static av_always_inline float quantize_and_encode_band_cost_template(
         scaled = s->scoefs;
     }
     s->aacdsp.quant_bands(s->qcoefs, in, scaled, size, !BT_UNSIGNED, aac_cb_maxval[cb], Q34, ROUNDING);
+    if (!BT_ESC && !pb && !out) {
+        qenergy = s->aacdsp.quant_cost[BT_UNSIGNED][BT_PAIR](s->qcost_rd, s->qcost_bits,
+                                                              in, s->qcoefs, size,
+                                                              aac_cb_range[cb],
+                                                              ff_aac_spectral_bits[cb-1],
+                                                              ff_aac_codebook_vectors[cb-1], IQ);
+        for (int i = 0; i < size / dim; i++) {
+            cost    += s->qcost_rd[i] * lambda + s->qcost_bits[i];
+            resbits += s->qcost_bits[i];
+            if (cost >= uplim)
+                return uplim;
+        }
+        if (bits)
+            *bits = resbits;
+        if (energy)
+            *energy = qenergy;
+        return cost;
+    }
     if (BT_UNSIGNED) {
         off = 0;
     } else {
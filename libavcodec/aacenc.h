@@ -229,6 +229,8 @@ typedef struct AACEncContext {
 
     AudioFrameQueue afq;
     DECLARE_ALIGNED(16, int,   qcoefs)[96];      ///< quantized coefficients
+    DECLARE_ALIGNED(16, float, qcost_rd)[48];    ///< distortion of each group of quantized coefficients
+    DECLARE_ALIGNED(16, int,   qcost_bits)[48];  ///< bits of each group of quantized coefficients
     DECLARE_ALIGNED(32, float, scoefs)[1024];    ///< scaled coefficients
 
     uint16_t quantize_band_cost_cache_generation;
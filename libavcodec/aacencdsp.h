@@ -20,9 +20,11 @@
 #define AVCODEC_AACENCDSP_H
 
 #include <math.h>
+#include <stdint.h>
 
 #include "config.h"
 
+#include "libavutil/attributes.h"
 #include "libavutil/macros.h"
 
 typedef struct AACEncDSPContext {
@@ -30,6 +32,24 @@ typedef struct AACEncDSPContext {
     void (*quant_bands)(int *out, const float *in, const float *scaled,
                         int size, int is_signed, int maxval, const float Q34,
                         const float rounding);
+    /**
+     * Compute the distortion and the number of bits of every group of
+     * 4 (quads) or 2 (pairs) coefficients of a band quantized by
+     * quant_bands, using a codebook without escape values.
+     * Indexed by [unsigned codebook][pair codebook].
+     *
+     * @return energy of the dequantized coefficients
+     */
+    float (*quant_cost[2][2])(float *rd, int *bits, const float *in,
+                              const int *quant, int size, int range,
+                              const uint8_t *spectral_bits,
+                              const float *vectors, const float IQ);
+    /**
+     * Compute the energy and the form factor (sum of the square roots of
+     * the magnitudes) of size coefficients, both summed in order.
+     */
+    void (*band_energy)(float *energy, float *form_factor,
+                        const float *in, int size);
 } AACEncDSPContext;
 
 void ff_aacenc_dsp_init_riscv(AACEncDSPContext *s);
@@ -57,10 +77,78 @@ static inline void quantize_bands(int *out, const float *in, const float *scaled
     }
 }
 
+static av_always_inline float quant_cost_template(float *rd, int *bits,
+                                                 const float *in, const int *quant,
+                                                 int size, int range,
+                                                 const uint8_t *spectral_bits,
+                                                 const float *vectors, const float IQ,
+                                                 int is_unsigned, int dim)
+{
+    const int off = is_unsigned ? 0 : range >> 1;
+    float qenergy = 0.0f;
+
+    for (int i = 0; i < size; i += dim) {
+        const float *vec;
+        int idx = 0, nbits;
+        float d = 0.0f;
+
+        for (int j = 0; j < dim; j++)
+            idx = idx * range + quant[i + j] + off;
+        nbits = spectral_bits[idx];
+        vec   = &vectors[idx * dim];
+        for (int j = 0; j < dim; j++) {
+            float quantized = vec[j] * IQ;
+            float di = (is_unsigned ? fabsf(in[i + j]) : in[i + j]) - quantized;
+
+            if (is_unsigned && vec[j] != 0.0f)
+                nbits++;
+            qenergy += quantized * quantized;
+            d += di * di;
+        }
+        rd[i / dim]   = d;
+        bits[i / dim] = nbits;
+    }
+    return qenergy;
+}
+
+#define QUANT_COST_FUNC(name, is_unsigned, dim)                               \
+static inline float quant_cost_ ## name(float *rd, int *bits,                 \
+                                        const float *in, const int *quant,    \
+                                        int size, int range,                  \
+                                        const uint8_t *spectral_bits,         \
+                                        const float *vectors, const float IQ) \
+{                                                                             \
+    return quant_cost_template(rd, bits, in, quant, size, range,              \
+                               spectral_bits, vectors, IQ, is_unsigned, dim); \
+}
+
+QUANT_COST_FUNC(squad, 0, 4)
+QUANT_COST_FUNC(spair, 0, 2)
+QUANT_COST_FUNC(uquad, 1, 4)
+QUANT_COST_FUNC(upair, 1, 2)
+
+static inline void band_energy(float *energy, float *form_factor,
+                               const float *in, int size)
+{
+    float e = 0.0f, ff = 0.0f;
+
+    for (int i = 0; i < size; i++) {
+        e  += in[i] * in[i];
+        ff += sqrtf(fabsf(in[i]));
+    }
+    *energy      = e;
+    *form_factor = ff;
+}
+
 static inline void ff_aacenc_dsp_init(AACEncDSPContext *s)
 {
     s->abs_pow34   = abs_pow34_v;
     s->quant_bands = quantize_bands;
+    s->quant_cost[0][0] = quant_cost_squad;
+    s->quant_cost[0][1] = quant_cost_spair;
+    s->quant_cost[1][0] = quant_cost_uquad;
+    s->quant_cost[1][1] = quant_cost_upair;
+    s->band_energy = band_energy;
 
 #if ARCH_RISCV
     ff_aacenc_dsp_init_riscv(s);
@@ -29,6 +29,7 @@
 
 #include "avcodec.h"
 #include "aac.h"
+#include "aacencdsp.h"
 #include "psymodel.h"
 
 /***********************************
@@ -161,6 +162,7 @@ typedef struct AacPsyContext{
     AacPsyCoeffs psy_coef[2][64];
     AacPsyChannel *ch;
     float global_quality; ///< normalized global quality taken from avctx
+    AACEncDSPContext dsp;
 }AacPsyContext;
 
 /**
@@ -316,6 +318,7 @@ static av_cold int psy_3gpp_init(FFPsyContext *ctx) {
         return AVERROR(ENOMEM);
     pctx = ctx->model_priv_data;
     pctx->global_quality = (ctx->avctx->global_quality ? ctx->avctx->global_quality : 120) * 0.01f;
+    ff_aacenc_dsp_init(&pctx->dsp);
 
     if (ctx->avctx->flags & AV_CODEC_FLAG_QSCALE) {
         /* Use the target average bitrate to compute spread parameters */
@@ -597,10 +600,11 @@ static float calc_reduced_thr_3gpp(AacPsyBand *band, float min_snr,
 }
 
 #ifndef calc_thr_3gpp
-static void calc_thr_3gpp(const FFPsyWindowInfo *wi, const int num_bands, AacPsyChannel *pch,
+static void calc_thr_3gpp(const AACEncDSPContext *dsp, const FFPsyWindowInfo *wi,
+                          const int num_bands, AacPsyChannel *pch,
                           const uint8_t *band_sizes, const float *coefs, const int cutoff)
 {
-    int i, w, g;
+    int w, g;
     int start = 0, wstart = 0;
     for (w = 0; w < wi->num_windows*16; w += 16) {
         wstart = 0;
@@ -610,12 +614,9 @@ static void calc_thr_3gpp(const FFPsyWindowInfo *wi, const int num_bands, AacPsy
             float form_factor = 0.0f;
             float Temp;
             band->energy = 0.0f;
-            if (wstart < cutoff) {
-                for (i = 0; i < band_sizes[g]; i++) {
-                    band->energy += coefs[start+i] * coefs[start+i];
-                    form_factor  += sqrtf(fabs(coefs[start+i]));
-                }
-            }
+            if (wstart < cutoff)
+                dsp->band_energy(&band->energy, &form_factor, &coefs[start],
+                                 band_sizes[g]);
             Temp = band->energy > 0 ? sqrtf((float)band_sizes[g] / band->energy) : 0;
             band->thr      = band->energy * 0.001258925f;
             band->nz_lines = form_factor * sqrtf(Temp);
@@ -666,7 +667,7 @@ static void psy_3gpp_analyze_channel(FFPsyContext *ctx, int channel,
     const int cutoff           = bandwidth * 2048 / wi->num_windows / ctx->avctx->sample_rate;
 
     //calculate energies, initial thresholds and related values - 5.4.2 "Threshold Calculation"
-    calc_thr_3gpp(wi, num_bands, pch, band_sizes, coefs, cutoff);
+    calc_thr_3gpp(&pctx->dsp, wi, num_bands, pch, band_sizes, coefs, cutoff);
 
     //modify thresholds and energies - spread, threshold in quiet, pre-echo control
     for (w = 0; w < wi->num_windows*16; w += 16) {
@@ -269,6 +269,8 @@ int i = 0;
     ff_hevc_dsp_init_x86(hevcdsp, bit_depth);
 #elif ARCH_MIPS
     ff_hevc_dsp_init_mips(hevcdsp, bit_depth);
+#elif ARCH_RISCV
+    ff_hevc_dsp_init_riscv(hevcdsp, bit_depth);
 #elif ARCH_LOONGARCH
     ff_hevc_dsp_init_loongarch(hevcdsp, bit_depth);
 #endif
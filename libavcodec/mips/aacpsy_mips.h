@@ -60,7 +60,8 @@
 
 #if HAVE_INLINE_ASM && HAVE_MIPSFPU && ( PSY_LAME_FIR_LEN == 21 )
 #if !HAVE_MIPS32R6 && !HAVE_MIPS64R6
-static void calc_thr_3gpp_mips(const FFPsyWindowInfo *wi, const int num_bands,
+static void calc_thr_3gpp_mips(const AACEncDSPContext *dsp,
+                               const FFPsyWindowInfo *wi, const int num_bands,
                                AacPsyChannel *pch, const uint8_t *band_sizes,
                                const float *coefs, const int cutoff)
 {
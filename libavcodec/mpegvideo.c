@@ -290,6 +290,13 @@ static av_cold int dct_init(MpegEncContext *s)
         }
     }
 
+    ff_mpv_unquantize_init(s);
+
+    return 0;
+}
+
+av_cold void ff_mpv_unquantize_init(MpegEncContext *s)
+{
     s->dct_unquantize_h263_intra = dct_unquantize_h263_intra_c;
     s->dct_unquantize_h263_inter = dct_unquantize_h263_inter_c;
     s->dct_unquantize_mpeg1_intra = dct_unquantize_mpeg1_intra_c;
@@ -309,13 +316,13 @@ static av_cold int dct_init(MpegEncContext *s)
     ff_mpv_common_init_arm(s);
 #elif ARCH_PPC
     ff_mpv_common_init_ppc(s);
+#elif ARCH_RISCV
+    ff_mpv_common_init_riscv(s);
 #elif ARCH_X86
     ff_mpv_common_init_x86(s);
 #elif ARCH_MIPS
     ff_mpv_common_init_mips(s);
 #endif
-
-    return 0;
 }
 
 av_cold void ff_init_scantable(const uint8_t *permutation, ScanTable *st,
@@ -77,11 +77,6 @@
 #include <limits.h>
 #include "sp5x.h"
 
-#define QUANT_BIAS_SHIFT 8
-
-#define QMAT_SHIFT_MMX 16
-#define QMAT_SHIFT 21
-
 static int encode_picture(MpegEncContext *s);
 static int dct_quantize_refine(MpegEncContext *s, int16_t *block, int16_t *weight, int16_t *orig, int n, int qscale);
 static int sse_mb(MpegEncContext *s);
@@ -289,7 +284,9 @@ static void mpv_encode_defaults(MpegEncContext *s)
 
 av_cold int ff_dct_encode_init(MpegEncContext *s)
 {
-#if ARCH_X86
+#if ARCH_RISCV
+    ff_dct_encode_init_riscv(s);
+#elif ARCH_X86
     ff_dct_encode_init_x86(s);
 #endif
 
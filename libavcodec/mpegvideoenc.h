@@ -35,6 +35,11 @@
 
 #define UNI_AC_ENC_INDEX(run,level) ((run)*128 + (level))
 
+#define QUANT_BIAS_SHIFT 8
+
+#define QMAT_SHIFT_MMX 16
+#define QMAT_SHIFT 21
+
 /* mpegvideo_enc common options */
 #define FF_MPV_FLAG_SKIP_RD      0x0001
 #define FF_MPV_FLAG_STRICT_GOP   0x0002
@@ -127,6 +132,7 @@ int ff_mpv_reallocate_putbitbuffer(MpegEncContext *s, size_t threshold, size_t s
 void ff_write_quant_matrix(PutBitContext *pb, uint16_t *matrix);
 
 int ff_dct_encode_init(MpegEncContext *s);
+void ff_dct_encode_init_riscv(MpegEncContext *s);
 void ff_dct_encode_init_x86(MpegEncContext *s);
 
 int ff_dct_quantize_c(MpegEncContext *s, int16_t *block, int n, int qscale, int *overflow);
@@ -88,7 +88,9 @@ av_cold int ff_proresdsp_init(ProresDSPContext *dsp, int bits_per_raw_sample)
         return AVERROR_BUG;
     }
 
-#if ARCH_X86
+#if ARCH_RISCV
+    ff_proresdsp_init_riscv(dsp, bits_per_raw_sample);
+#elif ARCH_X86
     ff_proresdsp_init_x86(dsp, bits_per_raw_sample);
 #endif
 
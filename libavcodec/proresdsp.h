@@ -34,6 +34,7 @@ typedef struct ProresDSPContext {
 
 int ff_proresdsp_init(ProresDSPContext *dsp, int bits_per_raw_sample);
 
+void ff_proresdsp_init_riscv(ProresDSPContext *dsp, int bits_per_raw_sample);
 void ff_proresdsp_init_x86(ProresDSPContext *dsp, int bits_per_raw_sample);
 
 #endif /* AVCODEC_PRORESDSP_H */
@@ -26,6 +26,27 @@
 #include "libavcodec/aacencdsp.h"
 
 void ff_abs_pow34_rvv(float *out, const float *in, const int size);
+void ff_aac_quant_bands_rvv(int *out, const float *in, const float *scaled,
+                            int size, int is_signed, int maxval, const float Q34,
+                            const float rounding);
+void ff_aac_band_energy_rvv(float *energy, float *form_factor,
+                            const float *in, int size);
+float ff_aac_quant_cost_squad_rvv(float *rd, int *bits, const float *in,
+                                  const int *quant, int size, int range,
+                                  const uint8_t *spectral_bits,
+                                  const float *vectors, const float IQ);
+float ff_aac_quant_cost_spair_rvv(float *rd, int *bits, const float *in,
+                                  const int *quant, int size, int range,
+                                  const uint8_t *spectral_bits,
+                                  const float *vectors, const float IQ);
+float ff_aac_quant_cost_uquad_rvv(float *rd, int *bits, const float *in,
+                                  const int *quant, int size, int range,
+                                  const uint8_t *spectral_bits,
+                                  const float *vectors, const float IQ);
+float ff_aac_quant_cost_upair_rvv(float *rd, int *bits, const float *in,
+                                  const int *quant, int size, int range,
+                                  const uint8_t *spectral_bits,
+                                  const float *vectors, const float IQ);
 
 av_cold void ff_aacenc_dsp_init_riscv(AACEncDSPContext *s)
 {
@@ -34,7 +55,13 @@ av_cold void ff_aacenc_dsp_init_riscv(AACEncDSPContext *s)
 
     if (flags & AV_CPU_FLAG_RVV_F32) {
         if (flags & AV_CPU_FLAG_RVB_ADDR) {
-            s->abs_pow34 = ff_abs_pow34_rvv;
+            s->abs_pow34   = ff_abs_pow34_rvv;
+            s->quant_bands = ff_aac_quant_bands_rvv;
+            s->quant_cost[0][0] = ff_aac_quant_cost_squad_rvv;
+            s->quant_cost[0][1] = ff_aac_quant_cost_spair_rvv;
+            s->quant_cost[1][0] = ff_aac_quant_cost_uquad_rvv;
+            s->quant_cost[1][1] = ff_aac_quant_cost_upair_rvv;
+            s->band_energy = ff_aac_band_energy_rvv;
         }
     }
 #endif
@@ -25,12 +25,26 @@
 #include "libavcodec/h264chroma.h"
 #include "config.h"
 
-void h264_put_chroma_mc8_rvv(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
-void h264_avg_chroma_mc8_rvv(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
-void h264_put_chroma_mc4_rvv(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
-void h264_avg_chroma_mc4_rvv(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
-void h264_put_chroma_mc2_rvv(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
-void h264_avg_chroma_mc2_rvv(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
+#define DECL_CHROMA_FUNCS(ext) \
+void h264_put_chroma_mc8_##ext(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y); \
+void h264_avg_chroma_mc8_##ext(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y); \
+void h264_put_chroma_mc4_##ext(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y); \
+void h264_avg_chroma_mc4_##ext(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y); \
+void h264_put_chroma_mc2_##ext(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y); \
+void h264_avg_chroma_mc2_##ext(uint8_t *p_dst, const uint8_t *p_src, ptrdiff_t stride, int h, int x, int y);
+
+DECL_CHROMA_FUNCS(rvv)
+DECL_CHROMA_FUNCS(rvv256)
+
+#define SET_CHROMA_FUNCS(ext) \
+do { \
+    c->put_h264_chroma_pixels_tab[0] = h264_put_chroma_mc8_##ext; \
+    c->avg_h264_chroma_pixels_tab[0] = h264_avg_chroma_mc8_##ext; \
+    c->put_h264_chroma_pixels_tab[1] = h264_put_chroma_mc4_##ext; \
+    c->avg_h264_chroma_pixels_tab[1] = h264_avg_chroma_mc4_##ext; \
+    c->put_h264_chroma_pixels_tab[2] = h264_put_chroma_mc2_##ext; \
+    c->avg_h264_chroma_pixels_tab[2] = h264_avg_chroma_mc2_##ext; \
+} while (0)
 
 av_cold void ff_h264chroma_init_riscv(H264ChromaContext *c, int bit_depth)
 {
@@ -38,13 +52,11 @@ av_cold void ff_h264chroma_init_riscv(H264ChromaContext *c, int bit_depth)
     int flags = av_get_cpu_flags();
 
     if (bit_depth == 8 && (flags & AV_CPU_FLAG_RVV_I32) &&
-        (flags & AV_CPU_FLAG_RVB_ADDR) && ff_get_rv_vlenb() >= 16) {
-        c->put_h264_chroma_pixels_tab[0] = h264_put_chroma_mc8_rvv;
-        c->avg_h264_chroma_pixels_tab[0] = h264_avg_chroma_mc8_rvv;
-        c->put_h264_chroma_pixels_tab[1] = h264_put_chroma_mc4_rvv;
-        c->avg_h264_chroma_pixels_tab[1] = h264_avg_chroma_mc4_rvv;
-        c->put_h264_chroma_pixels_tab[2] = h264_put_chroma_mc2_rvv;
-        c->avg_h264_chroma_pixels_tab[2] = h264_avg_chroma_mc2_rvv;
+        (flags & AV_CPU_FLAG_RVB_ADDR) && ff_rv_vlen_least(128)) {
+        if (ff_rv_vlen_least(256))
+            SET_CHROMA_FUNCS(rvv256);
+        else
+            SET_CHROMA_FUNCS(rvv);
     }
 #endif
 }
@@ -0,0 +1,170 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/h264dsp.h"
+
+#define IDCT_FUNCS(depth) \
+void ff_h264_idct_add_##depth##_rvv(uint8_t *dst, int16_t *block, int stride); \
+void ff_h264_idct8_add_##depth##_rvv(uint8_t *dst, int16_t *block, int stride); \
+void ff_h264_idct_dc_add_##depth##_rvv(uint8_t *dst, int16_t *block, \
+                                       int stride); \
+void ff_h264_idct8_dc_add_##depth##_rvv(uint8_t *dst, int16_t *block, \
+                                        int stride); \
+void ff_h264_idct_add16_##depth##_rvv(uint8_t *dst, const int *block_offset, \
+                                      int16_t *block, int stride, \
+                                      const uint8_t nnzc[5 * 8]); \
+void ff_h264_idct_add16intra_##depth##_rvv(uint8_t *dst, \
+                                           const int *block_offset, \
+                                           int16_t *block, int stride, \
+                                           const uint8_t nnzc[5 * 8]); \
+void ff_h264_idct8_add4_##depth##_rvv(uint8_t *dst, const int *block_offset, \
+                                      int16_t *block, int stride, \
+                                      const uint8_t nnzc[5 * 8]); \
+void ff_h264_idct_add8_##depth##_rvv(uint8_t **dst, const int *block_offset, \
+                                     int16_t *block, int stride, \
+                                     const uint8_t nnzc[15 * 8]);
+
+IDCT_FUNCS(8)
+IDCT_FUNCS(9)
+IDCT_FUNCS(10)
+
+void ff_h264_luma_dc_dequant_idct_8_rvv(int16_t *output, int16_t *input,
+                                        int qmul);
+
+#define LF_FUNC(dir, name, depth) \
+void ff_h264_##dir##_loop_filter_##name##_##depth##_rvv(uint8_t *pix, \
+                                                       ptrdiff_t stride, \
+                                                       int alpha, int beta, \
+                                                       int8_t *tc0);
+#define LF_INTRA_FUNC(dir, name, depth) \
+void ff_h264_##dir##_loop_filter_##name##_##depth##_rvv(uint8_t *pix, \
+                                                       ptrdiff_t stride, \
+                                                       int alpha, int beta);
+
+#define LF_FUNCS(depth) \
+LF_FUNC(v, luma, depth) \
+LF_FUNC(h, luma, depth) \
+LF_FUNC(h, luma_mbaff, depth) \
+LF_INTRA_FUNC(v, luma_intra, depth) \
+LF_INTRA_FUNC(h, luma_intra, depth) \
+LF_INTRA_FUNC(h, luma_mbaff_intra, depth) \
+LF_FUNC(v, chroma, depth) \
+LF_FUNC(h, chroma, depth) \
+LF_FUNC(h, chroma_mbaff, depth) \
+LF_FUNC(h, chroma422, depth) \
+LF_FUNC(h, chroma422_mbaff, depth) \
+LF_INTRA_FUNC(v, chroma_intra, depth) \
+LF_INTRA_FUNC(h, chroma_intra, depth) \
+LF_INTRA_FUNC(h, chroma_mbaff_intra, depth) \
+LF_INTRA_FUNC(h, chroma422_intra, depth) \
+LF_INTRA_FUNC(h, chroma422_mbaff_intra, depth)
+
+LF_FUNCS(8)
+LF_FUNCS(9)
+LF_FUNCS(10)
+
+/* The block loops save registers with ld/sd. */
+#if (__riscv_xlen == 64)
+#define SET_IDCT_LOOP_FUNCS(depth) \
+do { \
+    dsp->h264_idct_add16      = ff_h264_idct_add16_##depth##_rvv; \
+    dsp->h264_idct_add16intra = ff_h264_idct_add16intra_##depth##_rvv; \
+    dsp->h264_idct8_add4      = ff_h264_idct8_add4_##depth##_rvv; \
+    if (chroma_format_idc <= 1) \
+        dsp->h264_idct_add8   = ff_h264_idct_add8_##depth##_rvv; \
+} while (0)
+#else
+#define SET_IDCT_LOOP_FUNCS(depth) do { } while (0)
+#endif
+
+#define SET_IDCT_FUNCS(depth) \
+do { \
+    dsp->h264_idct_add        = ff_h264_idct_add_##depth##_rvv; \
+    dsp->h264_idct8_add       = ff_h264_idct8_add_##depth##_rvv; \
+    dsp->h264_idct_dc_add     = ff_h264_idct_dc_add_##depth##_rvv; \
+    dsp->h264_idct8_dc_add    = ff_h264_idct8_dc_add_##depth##_rvv; \
+    SET_IDCT_LOOP_FUNCS(depth); \
+} while (0)
+
+#define SET_LF_FUNCS(depth) \
+do { \
+    dsp->h264_v_loop_filter_luma    = ff_h264_v_loop_filter_luma_##depth##_rvv; \
+    dsp->h264_h_loop_filter_luma    = ff_h264_h_loop_filter_luma_##depth##_rvv; \
+    dsp->h264_h_loop_filter_luma_mbaff = \
+        ff_h264_h_loop_filter_luma_mbaff_##depth##_rvv; \
+    dsp->h264_v_loop_filter_luma_intra = \
+        ff_h264_v_loop_filter_luma_intra_##depth##_rvv; \
+    dsp->h264_h_loop_filter_luma_intra = \
+        ff_h264_h_loop_filter_luma_intra_##depth##_rvv; \
+    dsp->h264_h_loop_filter_luma_mbaff_intra = \
+        ff_h264_h_loop_filter_luma_mbaff_intra_##depth##_rvv; \
+    dsp->h264_v_loop_filter_chroma  = ff_h264_v_loop_filter_chroma_##depth##_rvv; \
+    dsp->h264_v_loop_filter_chroma_intra = \
+        ff_h264_v_loop_filter_chroma_intra_##depth##_rvv; \
+    if (chroma_format_idc <= 1) { \
+        dsp->h264_h_loop_filter_chroma = \
+            ff_h264_h_loop_filter_chroma_##depth##_rvv; \
+        dsp->h264_h_loop_filter_chroma_mbaff = \
+            ff_h264_h_loop_filter_chroma_mbaff_##depth##_rvv; \
+        dsp->h264_h_loop_filter_chroma_intra = \
+            ff_h264_h_loop_filter_chroma_intra_##depth##_rvv; \
+        dsp->h264_h_loop_filter_chroma_mbaff_intra = \
+            ff_h264_h_loop_filter_chroma_mbaff_intra_##depth##_rvv; \
+    } else { \
+        dsp->h264_h_loop_filter_chroma = \
+            ff_h264_h_loop_filter_chroma422_##depth##_rvv; \
+        dsp->h264_h_loop_filter_chroma_mbaff = \
+            ff_h264_h_loop_filter_chroma422_mbaff_##depth##_rvv; \
+        dsp->h264_h_loop_filter_chroma_intra = \
+            ff_h264_h_loop_filter_chroma422_intra_##depth##_rvv; \
+        dsp->h264_h_loop_filter_chroma_mbaff_intra = \
+            ff_h264_h_loop_filter_chroma422_mbaff_intra_##depth##_rvv; \
+    } \
+} while (0)
+
+av_cold void ff_h264dsp_init_riscv(H264DSPContext *dsp, const int bit_depth,
+                                   const int chroma_format_idc)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        switch (bit_depth) {
+        case 8:
+            SET_IDCT_FUNCS(8);
+            SET_LF_FUNCS(8);
+            dsp->h264_luma_dc_dequant_idct = ff_h264_luma_dc_dequant_idct_8_rvv;
+            break;
+        case 9:
+            SET_IDCT_FUNCS(9);
+            SET_LF_FUNCS(9);
+            break;
+        case 10:
+            SET_IDCT_FUNCS(10);
+            SET_LF_FUNCS(10);
+            break;
+        }
+    }
+#endif
+}
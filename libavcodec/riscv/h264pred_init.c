@@ -0,0 +1,145 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/codec_id.h"
+#include "libavcodec/h264pred.h"
+
+#define PRED4x4(mode) \
+void ff_pred4x4_##mode##_8_rvv(uint8_t *src, const uint8_t *topright, \
+                               ptrdiff_t stride);
+#define PRED8x8L(mode) \
+void ff_pred8x8l_##mode##_8_rvv(uint8_t *src, int has_topleft, \
+                                int has_topright, ptrdiff_t stride);
+#define PRED(size, mode) \
+void ff_pred##size##_##mode##_8_rvv(uint8_t *src, ptrdiff_t stride);
+
+PRED4x4(vertical)
+PRED4x4(horizontal)
+PRED4x4(dc)
+PRED4x4(left_dc)
+PRED4x4(top_dc)
+PRED4x4(128_dc)
+PRED4x4(down_left)
+PRED4x4(down_right)
+PRED4x4(vertical_right)
+PRED4x4(horizontal_down)
+PRED4x4(vertical_left)
+PRED4x4(horizontal_up)
+
+PRED8x8L(vertical)
+PRED8x8L(horizontal)
+PRED8x8L(dc)
+PRED8x8L(left_dc)
+PRED8x8L(top_dc)
+PRED8x8L(128_dc)
+PRED8x8L(down_left)
+PRED8x8L(down_right)
+PRED8x8L(vertical_right)
+PRED8x8L(horizontal_down)
+PRED8x8L(vertical_left)
+PRED8x8L(horizontal_up)
+
+PRED(8x8, vertical)
+PRED(8x8, horizontal)
+PRED(8x8, dc)
+PRED(8x8, left_dc)
+PRED(8x8, top_dc)
+PRED(8x8, 128_dc)
+PRED(8x8, plane)
+
+PRED(16x16, vertical)
+PRED(16x16, horizontal)
+PRED(16x16, dc)
+PRED(16x16, left_dc)
+PRED(16x16, top_dc)
+PRED(16x16, 128_dc)
+PRED(16x16, plane)
+
+av_cold void ff_h264_pred_init_riscv(H264PredContext *h, int codec_id,
+                                     const int bit_depth,
+                                     const int chroma_format_idc)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if (bit_depth != 8)
+        return;
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        if (codec_id == AV_CODEC_ID_H264) {
+            h->pred4x4[VERT_PRED           ] = ff_pred4x4_vertical_8_rvv;
+            h->pred4x4[HOR_PRED            ] = ff_pred4x4_horizontal_8_rvv;
+            h->pred4x4[DC_PRED             ] = ff_pred4x4_dc_8_rvv;
+            h->pred4x4[DIAG_DOWN_LEFT_PRED ] = ff_pred4x4_down_left_8_rvv;
+            h->pred4x4[DIAG_DOWN_RIGHT_PRED] = ff_pred4x4_down_right_8_rvv;
+            h->pred4x4[VERT_RIGHT_PRED     ] = ff_pred4x4_vertical_right_8_rvv;
+            h->pred4x4[HOR_DOWN_PRED       ] = ff_pred4x4_horizontal_down_8_rvv;
+            h->pred4x4[VERT_LEFT_PRED      ] = ff_pred4x4_vertical_left_8_rvv;
+            h->pred4x4[HOR_UP_PRED         ] = ff_pred4x4_horizontal_up_8_rvv;
+            h->pred4x4[LEFT_DC_PRED        ] = ff_pred4x4_left_dc_8_rvv;
+            h->pred4x4[TOP_DC_PRED         ] = ff_pred4x4_top_dc_8_rvv;
+            h->pred4x4[DC_128_PRED         ] = ff_pred4x4_128_dc_8_rvv;
+        }
+
+        if (chroma_format_idc <= 1) {
+            h->pred8x8[VERT_PRED8x8     ] = ff_pred8x8_vertical_8_rvv;
+            h->pred8x8[HOR_PRED8x8      ] = ff_pred8x8_horizontal_8_rvv;
+            if (codec_id != AV_CODEC_ID_VP7 && codec_id != AV_CODEC_ID_VP8)
+                h->pred8x8[PLANE_PRED8x8] = ff_pred8x8_plane_8_rvv;
+            h->pred8x8[DC_128_PRED8x8   ] = ff_pred8x8_128_dc_8_rvv;
+            if (codec_id != AV_CODEC_ID_RV40 && codec_id != AV_CODEC_ID_VP7 &&
+                codec_id != AV_CODEC_ID_VP8) {
+                h->pred8x8[DC_PRED8x8     ] = ff_pred8x8_dc_8_rvv;
+                h->pred8x8[LEFT_DC_PRED8x8] = ff_pred8x8_left_dc_8_rvv;
+                h->pred8x8[TOP_DC_PRED8x8 ] = ff_pred8x8_top_dc_8_rvv;
+            }
+        }
+
+        h->pred16x16[DC_PRED8x8     ] = ff_pred16x16_dc_8_rvv;
+        h->pred16x16[VERT_PRED8x8   ] = ff_pred16x16_vertical_8_rvv;
+        h->pred16x16[HOR_PRED8x8    ] = ff_pred16x16_horizontal_8_rvv;
+        h->pred16x16[LEFT_DC_PRED8x8] = ff_pred16x16_left_dc_8_rvv;
+        h->pred16x16[TOP_DC_PRED8x8 ] = ff_pred16x16_top_dc_8_rvv;
+        h->pred16x16[DC_128_PRED8x8 ] = ff_pred16x16_128_dc_8_rvv;
+        if (codec_id != AV_CODEC_ID_SVQ3 && codec_id != AV_CODEC_ID_RV40 &&
+            codec_id != AV_CODEC_ID_VP7 && codec_id != AV_CODEC_ID_VP8)
+            h->pred16x16[PLANE_PRED8x8  ] = ff_pred16x16_plane_8_rvv;
+
+        if (flags & AV_CPU_FLAG_RVV_I64) {
+            h->pred8x8l[VERT_PRED           ] = ff_pred8x8l_vertical_8_rvv;
+            h->pred8x8l[HOR_PRED            ] = ff_pred8x8l_horizontal_8_rvv;
+            h->pred8x8l[DC_PRED             ] = ff_pred8x8l_dc_8_rvv;
+            h->pred8x8l[DIAG_DOWN_LEFT_PRED ] = ff_pred8x8l_down_left_8_rvv;
+            h->pred8x8l[DIAG_DOWN_RIGHT_PRED] = ff_pred8x8l_down_right_8_rvv;
+            h->pred8x8l[VERT_RIGHT_PRED     ] = ff_pred8x8l_vertical_right_8_rvv;
+            h->pred8x8l[HOR_DOWN_PRED       ] = ff_pred8x8l_horizontal_down_8_rvv;
+            h->pred8x8l[VERT_LEFT_PRED      ] = ff_pred8x8l_vertical_left_8_rvv;
+            h->pred8x8l[HOR_UP_PRED         ] = ff_pred8x8l_horizontal_up_8_rvv;
+            h->pred8x8l[LEFT_DC_PRED        ] = ff_pred8x8l_left_dc_8_rvv;
+            h->pred8x8l[TOP_DC_PRED         ] = ff_pred8x8l_top_dc_8_rvv;
+            h->pred8x8l[DC_128_PRED         ] = ff_pred8x8l_128_dc_8_rvv;
+        }
+    }
+#endif
+}
@@ -0,0 +1,123 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/h264qpel.h"
+
+#define DECL_QPEL_FUNC(op, size, mc, depth, ext) \
+void ff_##op##_h264_qpel##size##_##mc##depth##_##ext(uint8_t *dst, \
+                                                     const uint8_t *src, \
+                                                     ptrdiff_t stride);
+
+#define DECL_QPEL_FUNCS(op, size, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc00, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc10, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc20, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc30, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc01, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc11, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc21, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc31, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc02, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc12, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc22, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc32, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc03, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc13, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc23, depth, ext) \
+    DECL_QPEL_FUNC(op, size, mc33, depth, ext)
+
+#define DECL_QPEL_DEPTH(depth) \
+    DECL_QPEL_FUNCS(put, 16, depth, rvv) \
+    DECL_QPEL_FUNCS(put,  8, depth, rvv) \
+    DECL_QPEL_FUNCS(put,  4, depth, rvv) \
+    DECL_QPEL_FUNCS(avg, 16, depth, rvv) \
+    DECL_QPEL_FUNCS(avg,  8, depth, rvv) \
+    DECL_QPEL_FUNCS(avg,  4, depth, rvv)
+
+DECL_QPEL_DEPTH()
+DECL_QPEL_DEPTH(_9)
+DECL_QPEL_DEPTH(_10)
+DECL_QPEL_FUNCS(put, 16, , rvv256)
+DECL_QPEL_FUNCS(put,  8, , rvv256)
+DECL_QPEL_FUNCS(avg, 16, , rvv256)
+DECL_QPEL_FUNCS(avg,  8, , rvv256)
+
+#define SET_QPEL_FUNCS(tab, op, idx, size, depth, ext) \
+do { \
+    c->tab[idx][ 0] = ff_##op##_h264_qpel##size##_mc00##depth##_##ext; \
+    c->tab[idx][ 1] = ff_##op##_h264_qpel##size##_mc10##depth##_##ext; \
+    c->tab[idx][ 2] = ff_##op##_h264_qpel##size##_mc20##depth##_##ext; \
+    c->tab[idx][ 3] = ff_##op##_h264_qpel##size##_mc30##depth##_##ext; \
+    c->tab[idx][ 4] = ff_##op##_h264_qpel##size##_mc01##depth##_##ext; \
+    c->tab[idx][ 5] = ff_##op##_h264_qpel##size##_mc11##depth##_##ext; \
+    c->tab[idx][ 6] = ff_##op##_h264_qpel##size##_mc21##depth##_##ext; \
+    c->tab[idx][ 7] = ff_##op##_h264_qpel##size##_mc31##depth##_##ext; \
+    c->tab[idx][ 8] = ff_##op##_h264_qpel##size##_mc02##depth##_##ext; \
+    c->tab[idx][ 9] = ff_##op##_h264_qpel##size##_mc12##depth##_##ext; \
+    c->tab[idx][10] = ff_##op##_h264_qpel##size##_mc22##depth##_##ext; \
+    c->tab[idx][11] = ff_##op##_h264_qpel##size##_mc32##depth##_##ext; \
+    c->tab[idx][12] = ff_##op##_h264_qpel##size##_mc03##depth##_##ext; \
+    c->tab[idx][13] = ff_##op##_h264_qpel##size##_mc13##depth##_##ext; \
+    c->tab[idx][14] = ff_##op##_h264_qpel##size##_mc23##depth##_##ext; \
+    c->tab[idx][15] = ff_##op##_h264_qpel##size##_mc33##depth##_##ext; \
+} while (0)
+
+#define SET_QPEL_DEPTH(depth) \
+do { \
+    SET_QPEL_FUNCS(put_h264_qpel_pixels_tab, put, 0, 16, depth, rvv); \
+    SET_QPEL_FUNCS(put_h264_qpel_pixels_tab, put, 1,  8, depth, rvv); \
+    SET_QPEL_FUNCS(put_h264_qpel_pixels_tab, put, 2,  4, depth, rvv); \
+    SET_QPEL_FUNCS(avg_h264_qpel_pixels_tab, avg, 0, 16, depth, rvv); \
+    SET_QPEL_FUNCS(avg_h264_qpel_pixels_tab, avg, 1,  8, depth, rvv); \
+    SET_QPEL_FUNCS(avg_h264_qpel_pixels_tab, avg, 2,  4, depth, rvv); \
+} while (0)
+
+av_cold void ff_h264qpel_init_riscv(H264QpelContext *c, int bit_depth)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        switch (bit_depth) {
+        case 8:
+            SET_QPEL_DEPTH();
+            /* Use the smallest register groups that fit a row. */
+            if (ff_rv_vlen_least(256)) {
+                SET_QPEL_FUNCS(put_h264_qpel_pixels_tab, put, 0, 16, , rvv256);
+                SET_QPEL_FUNCS(put_h264_qpel_pixels_tab, put, 1,  8, , rvv256);
+                SET_QPEL_FUNCS(avg_h264_qpel_pixels_tab, avg, 0, 16, , rvv256);
+                SET_QPEL_FUNCS(avg_h264_qpel_pixels_tab, avg, 1,  8, , rvv256);
+            }
+            break;
+        case 9:
+            SET_QPEL_DEPTH(_9);
+            break;
+        case 10:
+            SET_QPEL_DEPTH(_10);
+            break;
+        }
+    }
+#endif
+}
@@ -0,0 +1,199 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/hevcdsp.h"
+
+#define IDCT_FUNCS(depth) \
+void ff_hevc_idct_4x4_##depth##_rvv(int16_t *coeffs, int col_limit); \
+void ff_hevc_idct_8x8_##depth##_rvv(int16_t *coeffs, int col_limit); \
+void ff_hevc_idct_16x16_##depth##_rvv(int16_t *coeffs, int col_limit); \
+void ff_hevc_idct_32x32_##depth##_rvv(int16_t *coeffs, int col_limit); \
+void ff_hevc_idct_4x4_dc_##depth##_rvv(int16_t *coeffs); \
+void ff_hevc_idct_8x8_dc_##depth##_rvv(int16_t *coeffs); \
+void ff_hevc_idct_16x16_dc_##depth##_rvv(int16_t *coeffs); \
+void ff_hevc_idct_32x32_dc_##depth##_rvv(int16_t *coeffs); \
+void ff_hevc_transform_luma_4x4_##depth##_rvv(int16_t *coeffs); \
+void ff_hevc_dequant_##depth##_rvv(int16_t *coeffs, int16_t log2_size); \
+void ff_hevc_add_residual_4x4_##depth##_rvv(uint8_t *dst, const int16_t *res, \
+                                            ptrdiff_t stride); \
+void ff_hevc_add_residual_8x8_##depth##_rvv(uint8_t *dst, const int16_t *res, \
+                                            ptrdiff_t stride); \
+void ff_hevc_add_residual_16x16_##depth##_rvv(uint8_t *dst, \
+                                              const int16_t *res, \
+                                              ptrdiff_t stride); \
+void ff_hevc_add_residual_32x32_##depth##_rvv(uint8_t *dst, \
+                                              const int16_t *res, \
+                                              ptrdiff_t stride);
+
+IDCT_FUNCS(8)
+IDCT_FUNCS(10)
+
+#define FILTER_FUNCS(depth) \
+void ff_hevc_h_loop_filter_luma_##depth##_rvv(uint8_t *pix, ptrdiff_t stride, \
+        int beta, const int32_t *tc, const uint8_t *no_p, \
+        const uint8_t *no_q); \
+void ff_hevc_v_loop_filter_luma_##depth##_rvv(uint8_t *pix, ptrdiff_t stride, \
+        int beta, const int32_t *tc, const uint8_t *no_p, \
+        const uint8_t *no_q); \
+void ff_hevc_h_loop_filter_chroma_##depth##_rvv(uint8_t *pix, \
+        ptrdiff_t stride, const int32_t *tc, const uint8_t *no_p, \
+        const uint8_t *no_q); \
+void ff_hevc_v_loop_filter_chroma_##depth##_rvv(uint8_t *pix, \
+        ptrdiff_t stride, const int32_t *tc, const uint8_t *no_p, \
+        const uint8_t *no_q); \
+void ff_hevc_sao_band_filter_##depth##_rvv(uint8_t *dst, const uint8_t *src, \
+        ptrdiff_t stride_dst, ptrdiff_t stride_src, \
+        const int16_t *sao_offset_val, int sao_left_class, \
+        int width, int height); \
+void ff_hevc_sao_edge_filter_##depth##_rvv(uint8_t *dst, const uint8_t *src, \
+        ptrdiff_t stride_dst, const int16_t *sao_offset_val, int eo, \
+        int width, int height);
+
+FILTER_FUNCS(8)
+FILTER_FUNCS(10)
+
+#define MC_FUNCS(filt, dir, depth) \
+void ff_hevc_put_##filt##_##dir##_##depth##_rvv(int16_t *dst, \
+        const uint8_t *src, ptrdiff_t srcstride, int height, \
+        intptr_t mx, intptr_t my, int width); \
+void ff_hevc_put_##filt##_uni_##dir##_##depth##_rvv(uint8_t *dst, \
+        ptrdiff_t dststride, const uint8_t *src, ptrdiff_t srcstride, \
+        int height, intptr_t mx, intptr_t my, int width); \
+void ff_hevc_put_##filt##_uni_w_##dir##_##depth##_rvv(uint8_t *dst, \
+        ptrdiff_t dststride, const uint8_t *src, ptrdiff_t srcstride, \
+        int height, int denom, int wx, int ox, \
+        intptr_t mx, intptr_t my, int width); \
+void ff_hevc_put_##filt##_bi_##dir##_##depth##_rvv(uint8_t *dst, \
+        ptrdiff_t dststride, const uint8_t *src, ptrdiff_t srcstride, \
+        const int16_t *src2, int height, \
+        intptr_t mx, intptr_t my, int width); \
+void ff_hevc_put_##filt##_bi_w_##dir##_##depth##_rvv(uint8_t *dst, \
+        ptrdiff_t dststride, const uint8_t *src, ptrdiff_t srcstride, \
+        const int16_t *src2, int height, int denom, int wx0, int wx1, \
+        int ox0, int ox1, intptr_t mx, intptr_t my, int width);
+
+#define MC_DEPTH_FUNCS(depth) \
+MC_FUNCS(pel,  pixels, depth) \
+MC_FUNCS(qpel, h,      depth) \
+MC_FUNCS(qpel, v,      depth) \
+MC_FUNCS(qpel, hv,     depth) \
+MC_FUNCS(epel, h,      depth) \
+MC_FUNCS(epel, v,      depth) \
+MC_FUNCS(epel, hv,     depth)
+
+MC_DEPTH_FUNCS(8)
+MC_DEPTH_FUNCS(10)
+
+/* The functions handle any width, so every block size shares them. */
+#define SET_IDCT_FUNCS(depth) \
+do { \
+    c->idct[0]               = ff_hevc_idct_4x4_##depth##_rvv; \
+    c->idct[1]               = ff_hevc_idct_8x8_##depth##_rvv; \
+    c->idct[2]               = ff_hevc_idct_16x16_##depth##_rvv; \
+    c->idct[3]               = ff_hevc_idct_32x32_##depth##_rvv; \
+    c->idct_dc[0]            = ff_hevc_idct_4x4_dc_##depth##_rvv; \
+    c->idct_dc[1]            = ff_hevc_idct_8x8_dc_##depth##_rvv; \
+    c->idct_dc[2]            = ff_hevc_idct_16x16_dc_##depth##_rvv; \
+    c->idct_dc[3]            = ff_hevc_idct_32x32_dc_##depth##_rvv; \
+    c->transform_4x4_luma    = ff_hevc_transform_luma_4x4_##depth##_rvv; \
+    c->dequant               = ff_hevc_dequant_##depth##_rvv; \
+    c->add_residual[1]       = ff_hevc_add_residual_8x8_##depth##_rvv; \
+    c->add_residual[2]       = ff_hevc_add_residual_16x16_##depth##_rvv; \
+    c->add_residual[3]       = ff_hevc_add_residual_32x32_##depth##_rvv; \
+} while (0)
+
+/* The deblocking filters honour no_p and no_q, so they also serve as the
+ * PCM/lossless variants. */
+#define SET_FILTER_FUNCS(depth) \
+do { \
+    c->hevc_h_loop_filter_luma     = ff_hevc_h_loop_filter_luma_##depth##_rvv; \
+    c->hevc_v_loop_filter_luma     = ff_hevc_v_loop_filter_luma_##depth##_rvv; \
+    c->hevc_h_loop_filter_chroma   = ff_hevc_h_loop_filter_chroma_##depth##_rvv; \
+    c->hevc_v_loop_filter_chroma   = ff_hevc_v_loop_filter_chroma_##depth##_rvv; \
+    c->hevc_h_loop_filter_luma_c   = ff_hevc_h_loop_filter_luma_##depth##_rvv; \
+    c->hevc_v_loop_filter_luma_c   = ff_hevc_v_loop_filter_luma_##depth##_rvv; \
+    c->hevc_h_loop_filter_chroma_c = ff_hevc_h_loop_filter_chroma_##depth##_rvv; \
+    c->hevc_v_loop_filter_chroma_c = ff_hevc_v_loop_filter_chroma_##depth##_rvv; \
+    for (int i = 0; i < 5; i++) { \
+        c->sao_band_filter[i] = ff_hevc_sao_band_filter_##depth##_rvv; \
+        c->sao_edge_filter[i] = ff_hevc_sao_edge_filter_##depth##_rvv; \
+    } \
+} while (0)
+
+#define SET_MC(pel, filt, dir, v, h, depth) \
+do { \
+    for (int i = 1; i < 10; i++) { \
+        c->put_hevc_##pel[i][v][h] = \
+            ff_hevc_put_##filt##_##dir##_##depth##_rvv; \
+        c->put_hevc_##pel##_uni[i][v][h] = \
+            ff_hevc_put_##filt##_uni_##dir##_##depth##_rvv; \
+        c->put_hevc_##pel##_uni_w[i][v][h] = \
+            ff_hevc_put_##filt##_uni_w_##dir##_##depth##_rvv; \
+        c->put_hevc_##pel##_bi[i][v][h] = \
+            ff_hevc_put_##filt##_bi_##dir##_##depth##_rvv; \
+        c->put_hevc_##pel##_bi_w[i][v][h] = \
+            ff_hevc_put_##filt##_bi_w_##dir##_##depth##_rvv; \
+    } \
+} while (0)
+
+#define SET_MC_FUNCS(depth) \
+do { \
+    SET_MC(qpel, pel,  pixels, 0, 0, depth); \
+    SET_MC(qpel, qpel, h,      0, 1, depth); \
+    SET_MC(qpel, qpel, v,      1, 0, depth); \
+    SET_MC(qpel, qpel, hv,     1, 1, depth); \
+    SET_MC(epel, pel,  pixels, 0, 0, depth); \
+    SET_MC(epel, epel, h,      0, 1, depth); \
+    SET_MC(epel, epel, v,      1, 0, depth); \
+    SET_MC(epel, epel, hv,     1, 1, depth); \
+} while (0)
+
+av_cold void ff_hevc_dsp_init_riscv(HEVCDSPContext *c, const int bit_depth)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        switch (bit_depth) {
+        case 8:
+            SET_IDCT_FUNCS(8);
+#if (__riscv_xlen == 64)
+            SET_MC_FUNCS(8);
+#endif
+            SET_FILTER_FUNCS(8);
+            c->add_residual[0] = ff_hevc_add_residual_4x4_8_rvv;
+            break;
+        case 10:
+            SET_IDCT_FUNCS(10);
+#if (__riscv_xlen == 64)
+            SET_MC_FUNCS(10);
+#endif
+            SET_FILTER_FUNCS(10);
+            if (flags & AV_CPU_FLAG_RVV_I64)
+                c->add_residual[0] = ff_hevc_add_residual_4x4_10_rvv;
+            break;
+        }
+    }
+#endif
+}
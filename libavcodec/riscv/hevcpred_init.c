@@ -0,0 +1,181 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/common.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/hevcpred.h"
+
+#define PRED_FUNCS(depth) \
+void ff_hevc_pred_planar_2_##depth##_rvv(uint8_t *src, const uint8_t *top, \
+                                         const uint8_t *left, ptrdiff_t stride); \
+void ff_hevc_pred_planar_3_##depth##_rvv(uint8_t *src, const uint8_t *top, \
+                                         const uint8_t *left, ptrdiff_t stride); \
+void ff_hevc_pred_planar_4_##depth##_rvv(uint8_t *src, const uint8_t *top, \
+                                         const uint8_t *left, ptrdiff_t stride); \
+void ff_hevc_pred_planar_5_##depth##_rvv(uint8_t *src, const uint8_t *top, \
+                                         const uint8_t *left, ptrdiff_t stride); \
+void ff_hevc_pred_dc_##depth##_rvv(uint8_t *src, const uint8_t *top, \
+                                   const uint8_t *left, ptrdiff_t stride, \
+                                   int log2_size, int c_idx); \
+void ff_hevc_pred_angular_v_##depth##_rvv(uint8_t *src, const uint8_t *ref, \
+                                          ptrdiff_t stride, int size, \
+                                          int angle); \
+void ff_hevc_pred_angular_h_##depth##_rvv(uint8_t *src, const uint8_t *ref, \
+                                          ptrdiff_t stride, int size, \
+                                          int angle);
+
+PRED_FUNCS(8)
+PRED_FUNCS(10)
+
+#if HAVE_RVV
+static const int8_t intra_pred_angle[] = {
+     32,  26,  21,  17, 13,  9,  5, 2, 0, -2, -5, -9, -13, -17, -21, -26, -32,
+    -26, -21, -17, -13, -9, -5, -2, 0, 2,  5,  9, 13,  17,  21,  26,  32
+};
+
+static const int16_t inv_angle[] = {
+    -4096, -1638, -910, -630, -482, -390, -315, -256, -315, -390, -482,
+    -630, -910, -1638, -4096
+};
+
+static av_always_inline int get_pixel(const uint8_t *p, int i, int depth)
+{
+    return depth > 8 ? ((const uint16_t *)p)[i] : p[i];
+}
+
+static av_always_inline void set_pixel(uint8_t *p, int i, int v, int depth)
+{
+    if (depth > 8)
+        ((uint16_t *)p)[i] = v;
+    else
+        p[i] = v;
+}
+
+/*
+ * The projection of the side reference for negative angles and the edge
+ * filter of the pure horizontal and vertical modes are done here, the
+ * interpolation of the block for all modes is done by the assembly.
+ */
+static av_always_inline void pred_angular(uint8_t *src, const uint8_t *top,
+                                          const uint8_t *left,
+                                          ptrdiff_t stride, int c_idx,
+                                          int mode, int size, int depth)
+{
+    const int ps = 1 + (depth > 8);
+    const int angle = intra_pred_angle[mode - 2];
+    const int last = (size * angle) >> 5;
+    const uint8_t *main = mode >= 18 ? top : left;
+    const uint8_t *side = mode >= 18 ? left : top;
+    const uint8_t *ref = main - ps;
+    uint16_t ref_array[3 * 32 + 4];
+
+    if (angle < 0 && last < -1) {
+        uint8_t *ref_tmp = (uint8_t *)ref_array + size * ps;
+
+        for (int x = 0; x <= size; x++)
+            set_pixel(ref_tmp, x, get_pixel(main, x - 1, depth), depth);
+        for (int x = last; x <= -1; x++)
+            set_pixel(ref_tmp, x,
+                      get_pixel(side, -1 + ((x * inv_angle[mode - 11] + 128) >> 8),
+                                depth), depth);
+        ref = ref_tmp;
+    }
+
+    /* the assembly takes the stride in bytes */
+    stride *= ps;
+
+    if (mode >= 18) {
+        if (depth > 8)
+            ff_hevc_pred_angular_v_10_rvv(src, ref, stride, size, angle);
+        else
+            ff_hevc_pred_angular_v_8_rvv(src, ref, stride, size, angle);
+    } else {
+        if (depth > 8)
+            ff_hevc_pred_angular_h_10_rvv(src, ref, stride, size, angle);
+        else
+            ff_hevc_pred_angular_h_8_rvv(src, ref, stride, size, angle);
+    }
+
+    if ((mode == 26 || mode == 10) && c_idx == 0 && size < 32) {
+        const ptrdiff_t step = mode == 26 ? stride : ps;
+
+        for (int i = 0; i < size; i++) {
+            int v = get_pixel(main, 0, depth) +
+                    ((get_pixel(side, i, depth) - get_pixel(side, -1, depth)) >> 1);
+
+            set_pixel(src + i * step, 0, av_clip_uintp2(v, depth), depth);
+        }
+    }
+}
+
+#define PRED_ANGULAR(log2, size, depth) \
+static void pred_angular_##log2##_##depth##_rvv(uint8_t *src, \
+                                                const uint8_t *top, \
+                                                const uint8_t *left, \
+                                                ptrdiff_t stride, \
+                                                int c_idx, int mode) \
+{ \
+    pred_angular(src, top, left, stride, c_idx, mode, size, depth); \
+}
+
+PRED_ANGULAR(2,  4, 8)
+PRED_ANGULAR(3,  8, 8)
+PRED_ANGULAR(4, 16, 8)
+PRED_ANGULAR(5, 32, 8)
+PRED_ANGULAR(2,  4, 10)
+PRED_ANGULAR(3,  8, 10)
+PRED_ANGULAR(4, 16, 10)
+PRED_ANGULAR(5, 32, 10)
+
+#define SET_PRED_FUNCS(depth) \
+do { \
+    hpc->pred_planar[0]  = ff_hevc_pred_planar_2_##depth##_rvv; \
+    hpc->pred_planar[1]  = ff_hevc_pred_planar_3_##depth##_rvv; \
+    hpc->pred_planar[2]  = ff_hevc_pred_planar_4_##depth##_rvv; \
+    hpc->pred_planar[3]  = ff_hevc_pred_planar_5_##depth##_rvv; \
+    hpc->pred_dc         = ff_hevc_pred_dc_##depth##_rvv; \
+    hpc->pred_angular[0] = pred_angular_2_##depth##_rvv; \
+    hpc->pred_angular[1] = pred_angular_3_##depth##_rvv; \
+    hpc->pred_angular[2] = pred_angular_4_##depth##_rvv; \
+    hpc->pred_angular[3] = pred_angular_5_##depth##_rvv; \
+} while (0)
+#endif
+
+av_cold void ff_hevc_pred_init_riscv(HEVCPredContext *hpc, int bit_depth)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        switch (bit_depth) {
+        case 8:
+            SET_PRED_FUNCS(8);
+            break;
+        case 10:
+            SET_PRED_FUNCS(10);
+            break;
+        }
+    }
+#endif
+}
@@ -33,16 +33,52 @@ void ff_put_signed_pixels_clamped_rvv(const int16_t *block, uint8_t *pixels,
 void ff_add_pixels_clamped_rvv(const int16_t *block, uint8_t *pixels,
                                ptrdiff_t stride);
 
+#define SIMPLE_IDCT_FUNCS(depth) \
+void ff_simple_idct_put_int16_##depth##bit_rvv(uint8_t *dest, ptrdiff_t line_size, \
+                                              int16_t *block); \
+void ff_simple_idct_add_int16_##depth##bit_rvv(uint8_t *dest, ptrdiff_t line_size, \
+                                              int16_t *block); \
+void ff_simple_idct_int16_##depth##bit_rvv(int16_t *block);
+
+SIMPLE_IDCT_FUNCS(8)
+SIMPLE_IDCT_FUNCS(10)
+SIMPLE_IDCT_FUNCS(12)
+
+#define SET_SIMPLE_IDCT(depth) \
+do { \
+    c->idct_put  = ff_simple_idct_put_int16_##depth##bit_rvv; \
+    c->idct_add  = ff_simple_idct_add_int16_##depth##bit_rvv; \
+    c->idct      = ff_simple_idct_int16_##depth##bit_rvv; \
+    c->perm_type = FF_IDCT_PERM_NONE; \
+} while (0)
+
 av_cold void ff_idctdsp_init_riscv(IDCTDSPContext *c, AVCodecContext *avctx,
                                    unsigned high_bit_depth)
 {
 #if HAVE_RVV
     int flags = av_get_cpu_flags();
 
-    if ((flags & AV_CPU_FLAG_RVV_I64) && ff_get_rv_vlenb() >= 16) {
+    if ((flags & AV_CPU_FLAG_RVV_I64) && ff_rv_vlen_least(128)) {
         c->put_pixels_clamped = ff_put_pixels_clamped_rvv;
         c->put_signed_pixels_clamped = ff_put_signed_pixels_clamped_rvv;
         c->add_pixels_clamped = ff_add_pixels_clamped_rvv;
     }
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128) &&
+        avctx->lowres == 0) {
+        if (avctx->bits_per_raw_sample == 10 ||
+            avctx->bits_per_raw_sample == 9) {
+            /* the studio profile needs the 32-bit input IDCT */
+            if (!c->mpeg4_studio_profile)
+                SET_SIMPLE_IDCT(10);
+        } else if (avctx->bits_per_raw_sample == 12) {
+            SET_SIMPLE_IDCT(12);
+        } else if (!high_bit_depth &&
+                   (avctx->idct_algo == FF_IDCT_AUTO ||
+                    avctx->idct_algo == FF_IDCT_SIMPLEAUTO ||
+                    avctx->idct_algo == FF_IDCT_SIMPLE)) {
+            SET_SIMPLE_IDCT(8);
+        }
+    }
 #endif
 }
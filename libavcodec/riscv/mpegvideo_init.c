@@ -0,0 +1,123 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/avcodec.h"
+#include "libavcodec/mpegvideo.h"
+#include "libavcodec/mpegvideodata.h"
+
+void ff_h263_dequant_rvv(int16_t *block, size_t len, int qmul, int qadd);
+int ff_mpeg2_dequant_intra_rvv(int16_t *block, const uint8_t *perm,
+                               const uint16_t *matrix, size_t len, int qscale);
+int ff_mpeg2_dequant_inter_rvv(int16_t *block, const uint8_t *perm,
+                               const uint16_t *matrix, size_t len, int qscale);
+
+#if HAVE_RVV
+static void dct_unquantize_h263_intra_rvv(MpegEncContext *s,
+                                          int16_t *block, int n, int qscale)
+{
+    int qadd = 0, nCoeffs;
+
+    if (!s->h263_aic) {
+        block[0] *= n < 4 ? s->y_dc_scale : s->c_dc_scale;
+        qadd = (qscale - 1) | 1;
+    }
+
+    if (s->ac_pred)
+        nCoeffs = 63;
+    else
+        nCoeffs = s->intra_scantable.raster_end[s->block_last_index[n]];
+
+    ff_h263_dequant_rvv(block + 1, nCoeffs, qscale << 1, qadd);
+}
+
+static void dct_unquantize_h263_inter_rvv(MpegEncContext *s,
+                                          int16_t *block, int n, int qscale)
+{
+    int nCoeffs = s->inter_scantable.raster_end[s->block_last_index[n]];
+
+    ff_h263_dequant_rvv(block, nCoeffs + 1, qscale << 1, (qscale - 1) | 1);
+}
+
+static int mpeg2_dequant_intra(MpegEncContext *s, int16_t *block, int n,
+                               int qscale)
+{
+    int nCoeffs = s->alternate_scan ? 63 : s->block_last_index[n];
+
+    if (s->q_scale_type) qscale = ff_mpeg2_non_linear_qscale[qscale];
+    else                 qscale <<= 1;
+
+    block[0] *= n < 4 ? s->y_dc_scale : s->c_dc_scale;
+
+    return block[0] + ff_mpeg2_dequant_intra_rvv(block,
+                                                 s->intra_scantable.permutated + 1,
+                                                 s->intra_matrix, nCoeffs, qscale);
+}
+
+static void dct_unquantize_mpeg2_intra_rvv(MpegEncContext *s,
+                                           int16_t *block, int n, int qscale)
+{
+    mpeg2_dequant_intra(s, block, n, qscale);
+}
+
+static void dct_unquantize_mpeg2_intra_bitexact_rvv(MpegEncContext *s,
+                                                    int16_t *block, int n,
+                                                    int qscale)
+{
+    int sum = mpeg2_dequant_intra(s, block, n, qscale) - 1;
+
+    block[63] ^= sum & 1;
+}
+
+static void dct_unquantize_mpeg2_inter_rvv(MpegEncContext *s,
+                                           int16_t *block, int n, int qscale)
+{
+    int nCoeffs = s->alternate_scan ? 63 : s->block_last_index[n];
+    int sum;
+
+    if (s->q_scale_type) qscale = ff_mpeg2_non_linear_qscale[qscale];
+    else                 qscale <<= 1;
+
+    sum = ff_mpeg2_dequant_inter_rvv(block, s->intra_scantable.permutated,
+                                     s->inter_matrix, nCoeffs + 1, qscale) - 1;
+    block[63] ^= sum & 1;
+}
+#endif
+
+av_cold void ff_mpv_common_init_riscv(MpegEncContext *s)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        s->dct_unquantize_h263_intra = dct_unquantize_h263_intra_rvv;
+        s->dct_unquantize_h263_inter = dct_unquantize_h263_inter_rvv;
+        if (s->avctx->flags & AV_CODEC_FLAG_BITEXACT)
+            s->dct_unquantize_mpeg2_intra = dct_unquantize_mpeg2_intra_bitexact_rvv;
+        else
+            s->dct_unquantize_mpeg2_intra = dct_unquantize_mpeg2_intra_rvv;
+        s->dct_unquantize_mpeg2_inter = dct_unquantize_mpeg2_inter_rvv;
+    }
+#endif
+}
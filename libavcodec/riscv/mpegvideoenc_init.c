@@ -0,0 +1,100 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/avcodec.h"
+#include "libavcodec/idctdsp.h"
+#include "libavcodec/mpegvideoenc.h"
+
+int ff_dct_quantize_rvv(int16_t *block, const int *qmat,
+                        const uint8_t *scantable, int start, int bias,
+                        int *max);
+void ff_denoise_dct_rvv(int16_t *block, int *sum, const uint16_t *offset);
+
+#if HAVE_RVV
+static void denoise_dct_rvv(MpegEncContext *s, int16_t *block)
+{
+    const int intra = s->mb_intra;
+
+    s->dct_count[intra]++;
+    ff_denoise_dct_rvv(block, s->dct_error_sum[intra], s->dct_offset[intra]);
+}
+
+static int dct_quantize_rvv(MpegEncContext *s, int16_t *block, int n,
+                            int qscale, int *overflow)
+{
+    const uint8_t *scantable;
+    const int *qmat;
+    int bias, start_i, last_non_zero, max;
+
+    s->fdsp.fdct(block);
+
+    if (s->dct_error_sum)
+        s->denoise_dct(s, block);
+
+    if (s->mb_intra) {
+        int q;
+
+        if (!s->h263_aic)
+            q = (n < 4 ? s->y_dc_scale : s->c_dc_scale) << 3;
+        else
+            /* For AIC we skip quant/dequant of INTRADC */
+            q = 1 << 3;
+
+        /* note: block[0] is assumed to be positive */
+        block[0] = (block[0] + (q >> 1)) / q;
+        scantable = s->intra_scantable.scantable;
+        start_i = 1;
+        qmat = n < 4 ? s->q_intra_matrix[qscale]
+                     : s->q_chroma_intra_matrix[qscale];
+        bias = s->intra_quant_bias * (1 << (QMAT_SHIFT - QUANT_BIAS_SHIFT));
+    } else {
+        scantable = s->inter_scantable.scantable;
+        start_i = 0;
+        qmat = s->q_inter_matrix[qscale];
+        bias = s->inter_quant_bias * (1 << (QMAT_SHIFT - QUANT_BIAS_SHIFT));
+    }
+
+    last_non_zero = ff_dct_quantize_rvv(block, qmat, scantable, start_i,
+                                        bias, &max);
+    *overflow = s->max_qcoeff < max;
+
+    if (s->idsp.perm_type != FF_IDCT_PERM_NONE)
+        ff_block_permute(block, s->idsp.idct_permutation,
+                         scantable, last_non_zero);
+
+    return last_non_zero;
+}
+#endif
+
+av_cold void ff_dct_encode_init_riscv(MpegEncContext *s)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        s->dct_quantize = dct_quantize_rvv;
+        s->denoise_dct  = denoise_dct_rvv;
+    }
+#endif
+}
@@ -56,12 +56,12 @@ av_cold void ff_pixblockdsp_init_riscv(PixblockDSPContext *c,
     }
 
 #if HAVE_RVV
-    if ((cpu_flags & AV_CPU_FLAG_RVV_I32) && ff_get_rv_vlenb() >= 16) {
+    if ((cpu_flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
         c->diff_pixels = ff_diff_pixels_unaligned_rvv;
         c->diff_pixels_unaligned = ff_diff_pixels_unaligned_rvv;
     }
 
-    if ((cpu_flags & AV_CPU_FLAG_RVV_I64) && ff_get_rv_vlenb() >= 16) {
+    if ((cpu_flags & AV_CPU_FLAG_RVV_I64) && ff_rv_vlen_least(128)) {
         if (!high_bit_depth) {
             c->get_pixels = ff_get_pixels_8_rvv;
             c->get_pixels_unaligned = ff_get_pixels_unaligned_8_rvv;
@@ -0,0 +1,50 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/idctdsp.h"
+#include "libavcodec/proresdsp.h"
+
+void ff_prores_idct_put_10_rvv(uint16_t *out, ptrdiff_t linesize,
+                               int16_t *block, const int16_t *qmat);
+void ff_prores_idct_put_12_rvv(uint16_t *out, ptrdiff_t linesize,
+                               int16_t *block, const int16_t *qmat);
+
+av_cold void ff_proresdsp_init_riscv(ProresDSPContext *dsp,
+                                     int bits_per_raw_sample)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        if (bits_per_raw_sample == 10) {
+            dsp->idct_put = ff_prores_idct_put_10_rvv;
+            dsp->idct_permutation_type = FF_IDCT_PERM_NONE;
+        } else if (bits_per_raw_sample == 12) {
+            dsp->idct_put = ff_prores_idct_put_12_rvv;
+            dsp->idct_permutation_type = FF_IDCT_PERM_NONE;
+        }
+    }
+#endif
+}
@@ -0,0 +1,44 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavcodec/v210enc.h"
+
+void ff_v210_planar_pack_8_rvv(const uint8_t *y, const uint8_t *u,
+                               const uint8_t *v, uint8_t *dst,
+                               ptrdiff_t width);
+void ff_v210_planar_pack_10_rvv(const uint16_t *y, const uint16_t *u,
+                                const uint16_t *v, uint8_t *dst,
+                                ptrdiff_t width);
+
+av_cold void ff_v210enc_init_riscv(V210EncContext *s)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        s->pack_line_8  = ff_v210_planar_pack_8_rvv;
+        s->pack_line_10 = ff_v210_planar_pack_10_rvv;
+    }
+#endif
+}
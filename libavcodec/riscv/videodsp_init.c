@@ -0,0 +1,49 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/videodsp.h"
+
+void ff_emulated_edge_mc_8_rvv(uint8_t *dst, const uint8_t *src,
+                               ptrdiff_t dst_stride, ptrdiff_t src_stride,
+                               int block_w, int block_h,
+                               int src_x, int src_y, int w, int h);
+void ff_emulated_edge_mc_16_rvv(uint8_t *dst, const uint8_t *src,
+                                ptrdiff_t dst_stride, ptrdiff_t src_stride,
+                                int block_w, int block_h,
+                                int src_x, int src_y, int w, int h);
+
+av_cold void ff_videodsp_init_riscv(VideoDSPContext *ctx, int bpc)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if (flags & AV_CPU_FLAG_RVV_I32) {
+        if (bpc <= 8)
+            ctx->emulated_edge_mc = ff_emulated_edge_mc_8_rvv;
+        else
+            ctx->emulated_edge_mc = ff_emulated_edge_mc_16_rvv;
+    }
+#endif
+}
@@ -0,0 +1,242 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/vp9dsp.h"
+
+#define DECL_MC(op, name, sz, dir) \
+void ff_vp9_##op##_##name##sz##_##dir##_rvv(uint8_t *dst, ptrdiff_t dst_stride, \
+                                            const uint8_t *src, \
+                                            ptrdiff_t src_stride, \
+                                            int h, int mx, int my);
+
+#define DECL_MC_DIRS(op, name, sz) \
+    DECL_MC(op, name, sz, h) \
+    DECL_MC(op, name, sz, v) \
+    DECL_MC(op, name, sz, hv)
+
+#define DECL_MC_FILTERS(op, sz) \
+    DECL_MC_DIRS(op, smooth, sz) \
+    DECL_MC_DIRS(op, regular, sz) \
+    DECL_MC_DIRS(op, sharp, sz) \
+    DECL_MC_DIRS(op, bilin, sz)
+
+#define DECL_FPEL(type, sz) \
+void ff_vp9_##type##sz##_rvv(uint8_t *dst, ptrdiff_t dst_stride, \
+                             const uint8_t *src, ptrdiff_t src_stride, \
+                             int h, int mx, int my);
+
+#define DECL_MC_SIZE(sz) \
+    DECL_MC_FILTERS(put, sz) \
+    DECL_MC_FILTERS(avg, sz) \
+    DECL_FPEL(copy, sz) \
+    DECL_FPEL(avg, sz)
+
+DECL_MC_SIZE(64)
+DECL_MC_SIZE(32)
+DECL_MC_SIZE(16)
+DECL_MC_SIZE(8)
+DECL_MC_SIZE(4)
+
+#define DECL_IPRED(type, sz) \
+void ff_vp9_##type##_##sz##x##sz##_rvv(uint8_t *dst, ptrdiff_t stride, \
+                                       const uint8_t *left, \
+                                       const uint8_t *top);
+
+#define DECL_IPRED_SIZE(sz) \
+    DECL_IPRED(vert, sz) \
+    DECL_IPRED(hor, sz) \
+    DECL_IPRED(dc, sz) \
+    DECL_IPRED(dc_left, sz) \
+    DECL_IPRED(dc_top, sz) \
+    DECL_IPRED(dc_127, sz) \
+    DECL_IPRED(dc_128, sz) \
+    DECL_IPRED(dc_129, sz) \
+    DECL_IPRED(tm, sz)
+
+DECL_IPRED_SIZE(32)
+DECL_IPRED_SIZE(16)
+DECL_IPRED_SIZE(8)
+DECL_IPRED_SIZE(4)
+
+#define DECL_LPF(dir, wd) \
+void ff_vp9_loop_filter_##dir##_##wd##_rvv(uint8_t *dst, ptrdiff_t stride, \
+                                           int mb_lim, int lim, int hev_thr);
+
+#define DECL_LPF_DIRS(wd) \
+    DECL_LPF(h, wd) \
+    DECL_LPF(v, wd)
+
+DECL_LPF_DIRS(4_8)
+DECL_LPF_DIRS(8_8)
+DECL_LPF_DIRS(16_8)
+DECL_LPF_DIRS(16_16)
+DECL_LPF_DIRS(44_16)
+DECL_LPF_DIRS(48_16)
+DECL_LPF_DIRS(84_16)
+DECL_LPF_DIRS(88_16)
+
+#define DECL_ITXFM(type_a, type_b, sz) \
+void ff_vp9_##type_a##_##type_b##_##sz##_add_rvv(uint8_t *dst, ptrdiff_t stride, \
+                                                 int16_t *block, int eob);
+
+#define DECL_ITXFM_FUNCS(sz) \
+    DECL_ITXFM(idct,  idct,  sz) \
+    DECL_ITXFM(iadst, idct,  sz) \
+    DECL_ITXFM(idct,  iadst, sz) \
+    DECL_ITXFM(iadst, iadst, sz)
+
+DECL_ITXFM_FUNCS(4x4)
+DECL_ITXFM_FUNCS(8x8)
+DECL_ITXFM_FUNCS(16x16)
+DECL_ITXFM(idct, idct, 32x32)
+DECL_ITXFM(iwht, iwht, 4x4)
+
+static av_cold void vp9dsp_mc_init_riscv(VP9DSPContext *dsp)
+{
+#define init_fpel(idx, sz) \
+    for (int f = 0; f < N_FILTERS; f++) { \
+        dsp->mc[idx][f][0][0][0] = ff_vp9_copy##sz##_rvv; \
+        dsp->mc[idx][f][1][0][0] = ff_vp9_avg##sz##_rvv; \
+    }
+
+/* the 2-D filters spill their arguments with ld/sd */
+#if (__riscv_xlen == 64)
+#define init_subpel_hv(idx, filter, name, sz, op, avg) \
+    dsp->mc[idx][filter][avg][1][1] = ff_vp9_##op##_##name##sz##_hv_rvv
+#else
+#define init_subpel_hv(idx, filter, name, sz, op, avg) do { } while (0)
+#endif
+
+#define init_subpel(idx, filter, name, sz, op, avg) \
+    dsp->mc[idx][filter][avg][1][0] = ff_vp9_##op##_##name##sz##_h_rvv; \
+    dsp->mc[idx][filter][avg][0][1] = ff_vp9_##op##_##name##sz##_v_rvv; \
+    init_subpel_hv(idx, filter, name, sz, op, avg)
+
+#define init_subpel_ops(idx, filter, name, sz) \
+    init_subpel(idx, filter, name, sz, put, 0); \
+    init_subpel(idx, filter, name, sz, avg, 1)
+
+#define init_mc(idx, sz) \
+    init_fpel(idx, sz) \
+    init_subpel_ops(idx, FILTER_8TAP_SMOOTH,  smooth,  sz); \
+    init_subpel_ops(idx, FILTER_8TAP_REGULAR, regular, sz); \
+    init_subpel_ops(idx, FILTER_8TAP_SHARP,   sharp,   sz); \
+    init_subpel_ops(idx, FILTER_BILINEAR,     bilin,   sz)
+
+    init_mc(0, 64);
+    init_mc(1, 32);
+    init_mc(2, 16);
+    init_mc(3, 8);
+    init_mc(4, 4);
+
+#undef init_mc
+#undef init_subpel_ops
+#undef init_subpel
+#undef init_subpel_hv
+#undef init_fpel
+}
+
+static av_cold void vp9dsp_intrapred_init_riscv(VP9DSPContext *dsp)
+{
+#define init_ipred(tx, sz) \
+    dsp->intra_pred[tx][VERT_PRED]    = ff_vp9_vert_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][HOR_PRED]     = ff_vp9_hor_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][DC_PRED]      = ff_vp9_dc_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][LEFT_DC_PRED] = ff_vp9_dc_left_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][TOP_DC_PRED]  = ff_vp9_dc_top_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][DC_127_PRED]  = ff_vp9_dc_127_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][DC_128_PRED]  = ff_vp9_dc_128_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][DC_129_PRED]  = ff_vp9_dc_129_##sz##x##sz##_rvv; \
+    dsp->intra_pred[tx][TM_VP8_PRED]  = ff_vp9_tm_##sz##x##sz##_rvv
+
+    init_ipred(TX_4X4,   4);
+    init_ipred(TX_8X8,   8);
+    init_ipred(TX_16X16, 16);
+    init_ipred(TX_32X32, 32);
+
+#undef init_ipred
+}
+
+static av_cold void vp9dsp_loopfilter_init_riscv(VP9DSPContext *dsp)
+{
+    dsp->loop_filter_8[0][0] = ff_vp9_loop_filter_h_4_8_rvv;
+    dsp->loop_filter_8[0][1] = ff_vp9_loop_filter_v_4_8_rvv;
+    dsp->loop_filter_8[1][0] = ff_vp9_loop_filter_h_8_8_rvv;
+    dsp->loop_filter_8[1][1] = ff_vp9_loop_filter_v_8_8_rvv;
+    dsp->loop_filter_8[2][0] = ff_vp9_loop_filter_h_16_8_rvv;
+    dsp->loop_filter_8[2][1] = ff_vp9_loop_filter_v_16_8_rvv;
+
+    dsp->loop_filter_16[0] = ff_vp9_loop_filter_h_16_16_rvv;
+    dsp->loop_filter_16[1] = ff_vp9_loop_filter_v_16_16_rvv;
+
+    dsp->loop_filter_mix2[0][0][0] = ff_vp9_loop_filter_h_44_16_rvv;
+    dsp->loop_filter_mix2[0][0][1] = ff_vp9_loop_filter_v_44_16_rvv;
+    dsp->loop_filter_mix2[0][1][0] = ff_vp9_loop_filter_h_48_16_rvv;
+    dsp->loop_filter_mix2[0][1][1] = ff_vp9_loop_filter_v_48_16_rvv;
+    dsp->loop_filter_mix2[1][0][0] = ff_vp9_loop_filter_h_84_16_rvv;
+    dsp->loop_filter_mix2[1][0][1] = ff_vp9_loop_filter_v_84_16_rvv;
+    dsp->loop_filter_mix2[1][1][0] = ff_vp9_loop_filter_h_88_16_rvv;
+    dsp->loop_filter_mix2[1][1][1] = ff_vp9_loop_filter_v_88_16_rvv;
+}
+
+static av_cold void vp9dsp_itxfm_init_riscv(VP9DSPContext *dsp)
+{
+#define init_itxfm(tx, sz) \
+    dsp->itxfm_add[tx][DCT_DCT]   = ff_vp9_idct_idct_##sz##_add_rvv; \
+    dsp->itxfm_add[tx][DCT_ADST]  = ff_vp9_iadst_idct_##sz##_add_rvv; \
+    dsp->itxfm_add[tx][ADST_DCT]  = ff_vp9_idct_iadst_##sz##_add_rvv; \
+    dsp->itxfm_add[tx][ADST_ADST] = ff_vp9_iadst_iadst_##sz##_add_rvv
+
+#define init_idct(tx, nm) \
+    dsp->itxfm_add[tx][DCT_DCT]   = \
+    dsp->itxfm_add[tx][ADST_DCT]  = \
+    dsp->itxfm_add[tx][DCT_ADST]  = \
+    dsp->itxfm_add[tx][ADST_ADST] = ff_vp9_##nm##_add_rvv
+
+    init_itxfm(TX_4X4,   4x4);
+    init_itxfm(TX_8X8,   8x8);
+    init_itxfm(TX_16X16, 16x16);
+    init_idct(TX_32X32,  idct_idct_32x32);
+    init_idct(4 /* lossless */, iwht_iwht_4x4);
+
+#undef init_itxfm
+#undef init_idct
+}
+
+av_cold void ff_vp9dsp_init_riscv(VP9DSPContext *dsp, int bpp)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if (bpp != 8)
+        return;
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        vp9dsp_intrapred_init_riscv(dsp);
+        vp9dsp_itxfm_init_riscv(dsp);
+        vp9dsp_loopfilter_init_riscv(dsp);
+        vp9dsp_mc_init_riscv(dsp);
+    }
+#endif
+}
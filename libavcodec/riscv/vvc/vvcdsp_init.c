@@ -0,0 +1,153 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/macros.h"
+#include "libavutil/riscv/cpu.h"
+#include "libavcodec/vvc/vvcdec.h"
+#include "libavcodec/vvc/vvcdsp.h"
+
+#define DECL_PUT(type, dir) \
+void ff_vvc_put_##type##_##dir##_8_rvv(int16_t *dst, const uint8_t *src, \
+                                       ptrdiff_t src_stride, int height, \
+                                       const int8_t *hf, const int8_t *vf, \
+                                       int width); \
+void ff_vvc_put_uni_##type##_##dir##_8_rvv(uint8_t *dst, ptrdiff_t dst_stride, \
+                                           const uint8_t *src, \
+                                           ptrdiff_t src_stride, int height, \
+                                           const int8_t *hf, const int8_t *vf, \
+                                           int width);
+
+#define DECL_PUT_DIRS(type) \
+    DECL_PUT(type, h) \
+    DECL_PUT(type, v) \
+    DECL_PUT(type, hv)
+
+DECL_PUT_DIRS(luma)
+DECL_PUT_DIRS(chroma)
+
+void ff_vvc_put_pixels_8_rvv(int16_t *dst, const uint8_t *src,
+                             ptrdiff_t src_stride, int height,
+                             const int8_t *hf, const int8_t *vf, int width);
+void ff_vvc_put_uni_pixels_8_rvv(uint8_t *dst, ptrdiff_t dst_stride,
+                                 const uint8_t *src, ptrdiff_t src_stride,
+                                 int height, const int8_t *hf,
+                                 const int8_t *vf, int width);
+void ff_vvc_avg_8_rvv(uint8_t *dst, ptrdiff_t dst_stride,
+                      const int16_t *src0, const int16_t *src1,
+                      int width, int height);
+void ff_vvc_w_avg_8_rvv(uint8_t *dst, ptrdiff_t dst_stride,
+                        const int16_t *src0, const int16_t *src1,
+                        int width, int height, int denom,
+                        int w0, int w1, int o0, int o1);
+
+#define DECL_ITX(type, sz) \
+void ff_vvc_inv_##type##_##sz##_rvv(int *coeffs, ptrdiff_t step, size_t nz);
+
+#define DECL_ITX_SIZES(type) \
+    DECL_ITX(type, 4) \
+    DECL_ITX(type, 8) \
+    DECL_ITX(type, 16) \
+    DECL_ITX(type, 32)
+
+DECL_ITX_SIZES(dct2)
+DECL_ITX(dct2, 64)
+DECL_ITX_SIZES(dst7)
+DECL_ITX_SIZES(dct8)
+
+void ff_vvc_add_residual_8_rvv(uint8_t *dst, const int *res,
+                               int width, int height, ptrdiff_t stride);
+void ff_vvc_add_residual_joint_8_rvv(uint8_t *dst, const int *res,
+                                     int width, int height, ptrdiff_t stride,
+                                     int c_sign, int shift);
+
+#define DECL_ALF(type) \
+void ff_vvc_alf_filter_##type##_8_rvv(uint8_t *dst, ptrdiff_t dst_stride, \
+                                      const uint8_t *src, \
+                                      ptrdiff_t src_stride, \
+                                      int width, int height, \
+                                      const int16_t *filter, \
+                                      const int16_t *clip, int vb_pos);
+
+DECL_ALF(luma)
+DECL_ALF(chroma)
+
+static av_cold void vvc_inter_init_riscv(VVCInterDSPContext *inter)
+{
+#define init_put(c, type) \
+    inter->put[c][i][0][0]     = ff_vvc_put_pixels_8_rvv; \
+    inter->put[c][i][0][1]     = ff_vvc_put_##type##_h_8_rvv; \
+    inter->put[c][i][1][0]     = ff_vvc_put_##type##_v_8_rvv; \
+    inter->put[c][i][1][1]     = ff_vvc_put_##type##_hv_8_rvv; \
+    inter->put_uni[c][i][0][0] = ff_vvc_put_uni_pixels_8_rvv; \
+    inter->put_uni[c][i][0][1] = ff_vvc_put_uni_##type##_h_8_rvv; \
+    inter->put_uni[c][i][1][0] = ff_vvc_put_uni_##type##_v_8_rvv; \
+    inter->put_uni[c][i][1][1] = ff_vvc_put_uni_##type##_hv_8_rvv
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(inter->put[0]); i++) {
+        init_put(LUMA,   luma);
+        init_put(CHROMA, chroma);
+    }
+
+#undef init_put
+
+    inter->avg   = ff_vvc_avg_8_rvv;
+    inter->w_avg = ff_vvc_w_avg_8_rvv;
+}
+
+static av_cold void vvc_itx_init_riscv(VVCItxDSPContext *itx)
+{
+#define init_itx(TYPE, type) \
+    itx->itx[TYPE][TX_SIZE_4]  = ff_vvc_inv_##type##_4_rvv; \
+    itx->itx[TYPE][TX_SIZE_8]  = ff_vvc_inv_##type##_8_rvv; \
+    itx->itx[TYPE][TX_SIZE_16] = ff_vvc_inv_##type##_16_rvv; \
+    itx->itx[TYPE][TX_SIZE_32] = ff_vvc_inv_##type##_32_rvv
+
+    init_itx(DCT2, dct2);
+    init_itx(DST7, dst7);
+    init_itx(DCT8, dct8);
+    itx->itx[DCT2][TX_SIZE_64] = ff_vvc_inv_dct2_64_rvv;
+
+#undef init_itx
+
+    itx->add_residual       = ff_vvc_add_residual_8_rvv;
+    itx->add_residual_joint = ff_vvc_add_residual_joint_8_rvv;
+}
+
+av_cold void ff_vvc_dsp_init_riscv(VVCDSPContext *c, const int bd)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if (bd != 8)
+        return;
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR) &&
+        ff_rv_vlen_least(128)) {
+        vvc_inter_init_riscv(&c->inter);
+        vvc_itx_init_riscv(&c->itx);
+        c->alf.filter[LUMA]   = ff_vvc_alf_filter_luma_8_rvv;
+        c->alf.filter[CHROMA] = ff_vvc_alf_filter_chroma_8_rvv;
+    }
+#endif
+}
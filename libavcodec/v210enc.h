@@ -32,6 +32,7 @@ typedef struct V210EncContext {
     int sample_factor_10;
 } V210EncContext;
 
+void ff_v210enc_init_riscv(V210EncContext *s);
 void ff_v210enc_init_x86(V210EncContext *s);
 
 #endif /* AVCODEC_V210ENC_H */
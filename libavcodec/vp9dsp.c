@@ -104,6 +104,8 @@ av_cold void ff_vp9dsp_init(VP9DSPContext *dsp, int bpp, int bitexact)
     ff_vp9dsp_init_x86(dsp, bpp, bitexact);
 #elif ARCH_MIPS
     ff_vp9dsp_init_mips(dsp, bpp);
+#elif ARCH_RISCV
+    ff_vp9dsp_init_riscv(dsp, bpp);
 #elif ARCH_LOONGARCH
     ff_vp9dsp_init_loongarch(dsp, bpp);
 #endif
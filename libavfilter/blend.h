@@ -82,5 +82,6 @@ typedef struct FilterParams {
 } FilterParams;
 
 void ff_blend_init_x86(FilterParams *param, int depth);
+void ff_blend_init_riscv(FilterParams *param, int depth);
 
 #endif /* AVFILTER_BLEND_H */
@@ -222,5 +222,7 @@ av_cold void ff_bwdif_init_filter_line(BWDIFDSPContext *s, int bit_depth)
     ff_bwdif_init_x86(s, bit_depth);
 #elif ARCH_AARCH64
     ff_bwdif_init_aarch64(s, bit_depth);
+#elif ARCH_RISCV
+    ff_bwdif_init_riscv(s, bit_depth);
 #endif
 }
@@ -40,6 +40,7 @@ typedef struct BWDIFDSPContext {
 void ff_bwdif_init_filter_line(BWDIFDSPContext *bwdif, int bit_depth);
 void ff_bwdif_init_x86(BWDIFDSPContext *bwdif, int bit_depth);
 void ff_bwdif_init_aarch64(BWDIFDSPContext *bwdif, int bit_depth);
+void ff_bwdif_init_riscv(BWDIFDSPContext *bwdif, int bit_depth);
 
 void ff_bwdif_filter_edge_c(void *dst1, const void *prev1, const void *cur1, const void *next1,
                             int w, int prefs, int mrefs, int prefs2, int mrefs2,
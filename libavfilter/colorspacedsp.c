@@ -143,7 +143,9 @@ void ff_colorspacedsp_init(ColorSpaceDSPContext *dsp)
 
     dsp->multiply3x3 = multiply3x3_c;
 
-#if ARCH_X86
+#if ARCH_RISCV
+    ff_colorspacedsp_riscv_init(dsp);
+#elif ARCH_X86
     ff_colorspacedsp_x86_init(dsp);
 #endif
 }
@@ -64,6 +64,8 @@ typedef struct ConvolutionContext {
 
 void ff_convolution_init_x86(ConvolutionContext *s);
 void ff_sobel_init_x86(ConvolutionContext *s, int depth, int nb_planes);
+void ff_convolution_init_riscv(ConvolutionContext *s);
+void ff_sobel_init_riscv(ConvolutionContext *s, int depth, int nb_planes);
 
 static void setup_3x3(int radius, const uint8_t *c[], const uint8_t *src, int stride,
                       int x, int w, int y, int h, int bpc)
@@ -134,6 +136,8 @@ static av_unused void ff_sobel_init(ConvolutionContext *s, int depth, int nb_pla
             s->filter[i] = filter16_sobel;
 #if ARCH_X86_64
     ff_sobel_init_x86(s, depth, nb_planes);
+#elif ARCH_RISCV
+    ff_sobel_init_riscv(s, depth, nb_planes);
 #endif
 }
 #endif
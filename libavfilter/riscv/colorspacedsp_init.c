@@ -0,0 +1,316 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/common.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/colorspacedsp.h"
+
+typedef void (*yuv2rgb_row_fn)(int16_t *r, int16_t *g, int16_t *b,
+                               const uint8_t *y, const uint8_t *u,
+                               const uint8_t *v, int w, const int32_t *k);
+typedef void (*yuv2yuv_row_fn)(uint8_t *y_out, uint8_t *u_out, uint8_t *v_out,
+                               const uint8_t *y_in, const uint8_t *u_in,
+                               const uint8_t *v_in, int w, const int32_t *k);
+typedef void (*rgb2yuv_luma_row_fn)(uint8_t *y, const int16_t *r,
+                                    const int16_t *g, const int16_t *b,
+                                    int w, const int32_t *k);
+typedef void (*rgb2yuv_chroma_row_fn)(uint8_t *u, uint8_t *v, const int16_t *r,
+                                      const int16_t *g, const int16_t *b,
+                                      int w, ptrdiff_t stride, const int32_t *k);
+
+#define YUV2RGB_ROW(ss, depth) \
+void ff_colorspace_yuv2rgb_##ss##p##depth##_row_rvv(int16_t *r, int16_t *g, \
+        int16_t *b, const uint8_t *y, const uint8_t *u, const uint8_t *v,  \
+        int w, const int32_t *k);
+#define YUV2YUV_ROW(ss, idepth, odepth) \
+void ff_colorspace_yuv2yuv_##ss##p##idepth##to##odepth##_row_rvv(         \
+        uint8_t *y_out, uint8_t *u_out, uint8_t *v_out,                     \
+        const uint8_t *y_in, const uint8_t *u_in, const uint8_t *v_in,      \
+        int w, const int32_t *k);
+#define RGB2YUV_ROWS(depth) \
+void ff_colorspace_rgb2yuv_luma_p##depth##_row_rvv(uint8_t *y,             \
+        const int16_t *r, const int16_t *g, const int16_t *b, int w,       \
+        const int32_t *k);                                                  \
+void ff_colorspace_rgb2yuv_chroma_444p##depth##_row_rvv(uint8_t *u,        \
+        uint8_t *v, const int16_t *r, const int16_t *g, const int16_t *b,  \
+        int w, ptrdiff_t stride, const int32_t *k);                         \
+void ff_colorspace_rgb2yuv_chroma_422p##depth##_row_rvv(uint8_t *u,        \
+        uint8_t *v, const int16_t *r, const int16_t *g, const int16_t *b,  \
+        int w, ptrdiff_t stride, const int32_t *k);                         \
+void ff_colorspace_rgb2yuv_chroma_420p##depth##_row_rvv(uint8_t *u,        \
+        uint8_t *v, const int16_t *r, const int16_t *g, const int16_t *b,  \
+        int w, ptrdiff_t stride, const int32_t *k);
+
+#define ROWS(depth)                 \
+    YUV2RGB_ROW(444, depth)         \
+    YUV2RGB_ROW(422, depth)         \
+    YUV2YUV_ROW(444, depth, 8)      \
+    YUV2YUV_ROW(444, depth, 10)     \
+    YUV2YUV_ROW(444, depth, 12)     \
+    YUV2YUV_ROW(422, depth, 8)      \
+    YUV2YUV_ROW(422, depth, 10)     \
+    YUV2YUV_ROW(422, depth, 12)     \
+    RGB2YUV_ROWS(depth)
+
+ROWS(8)
+ROWS(10)
+ROWS(12)
+
+void ff_colorspace_multiply3x3_row_rvv(int16_t *buf0, int16_t *buf1,
+                                       int16_t *buf2, int w,
+                                       const int16_t m[3][3][8]);
+
+/*
+ * Row loops of the C functions in colorspacedsp_template.c; the 420 luma
+ * rows are converted in pairs sharing the same chroma row.
+ */
+static av_always_inline void
+yuv2rgb_rvv(int16_t *rgb[3], ptrdiff_t rgb_stride, uint8_t *yuv[3],
+            const ptrdiff_t yuv_stride[3], int w, int h,
+            const int16_t c[3][3][8], const int16_t yuv_offset[8],
+            int ss_w, int ss_h, yuv2rgb_row_fn row)
+{
+    const int32_t k[6] = {
+        c[0][0][0], c[0][2][0], c[1][1][0], c[1][2][0], c[2][1][0],
+        yuv_offset[0],
+    };
+    int16_t *rgb0 = rgb[0], *rgb1 = rgb[1], *rgb2 = rgb[2];
+    const uint8_t *yuv0 = yuv[0], *yuv1 = yuv[1], *yuv2 = yuv[2];
+
+    w = AV_CEIL_RSHIFT(w, ss_w);
+    h = AV_CEIL_RSHIFT(h, ss_h);
+    for (int y = 0; y < h; y++) {
+        row(rgb0, rgb1, rgb2, yuv0, yuv1, yuv2, w, k);
+        if (ss_h)
+            row(rgb0 + rgb_stride, rgb1 + rgb_stride, rgb2 + rgb_stride,
+                yuv0 + yuv_stride[0], yuv1, yuv2, w, k);
+
+        yuv0 += yuv_stride[0] << ss_h;
+        yuv1 += yuv_stride[1];
+        yuv2 += yuv_stride[2];
+        rgb0 += rgb_stride << ss_h;
+        rgb1 += rgb_stride << ss_h;
+        rgb2 += rgb_stride << ss_h;
+    }
+}
+
+static av_always_inline void
+yuv2yuv_rvv(uint8_t *dst[3], const ptrdiff_t dst_stride[3],
+            uint8_t *src[3], const ptrdiff_t src_stride[3],
+            int w, int h, const int16_t c[3][3][8],
+            const int16_t yuv_offset[2][8], int idepth, int odepth,
+            int ss_w, int ss_h, yuv2yuv_row_fn row)
+{
+    const int sh = 14 + idepth - odepth;
+    const int rnd = 1 << (sh - 1);
+    const int uv_off_in = 128 << (idepth - 8);
+    const int uv_off_out = rnd + (128 << (odepth - 8 + sh));
+    int cyy = c[0][0][0], cyu = c[0][1][0], cyv = c[0][2][0];
+    int cuu = c[1][1][0], cuv = c[1][2][0], cvu = c[2][1][0], cvv = c[2][2][0];
+    const int32_t k[10] = {
+        cyy, cyu, cyv, cuu, cuv, cvu, cvv,
+        rnd + (yuv_offset[1][0] << sh) - cyy * yuv_offset[0][0] -
+        uv_off_in * (cyu + cyv),
+        uv_off_out - uv_off_in * (cuu + cuv),
+        uv_off_out - uv_off_in * (cvu + cvv),
+    };
+    uint8_t *dst0 = dst[0], *dst1 = dst[1], *dst2 = dst[2];
+    const uint8_t *src0 = src[0], *src1 = src[1], *src2 = src[2];
+
+    w = AV_CEIL_RSHIFT(w, ss_w);
+    h = AV_CEIL_RSHIFT(h, ss_h);
+    for (int y = 0; y < h; y++) {
+        row(dst0, dst1, dst2, src0, src1, src2, w, k);
+        if (ss_h)
+            row(dst0 + dst_stride[0], NULL, NULL, src0 + src_stride[0],
+                src1, src2, w, k);
+
+        dst0 += dst_stride[0] << ss_h;
+        dst1 += dst_stride[1];
+        dst2 += dst_stride[2];
+        src0 += src_stride[0] << ss_h;
+        src1 += src_stride[1];
+        src2 += src_stride[2];
+    }
+}
+
+static av_always_inline void
+rgb2yuv_rvv(uint8_t *yuv[3], const ptrdiff_t yuv_stride[3],
+            int16_t *rgb[3], ptrdiff_t s, int w, int h,
+            const int16_t c[3][3][8], const int16_t yuv_offset[8],
+            int depth, int ss_w, int ss_h, rgb2yuv_luma_row_fn luma,
+            rgb2yuv_chroma_row_fn chroma)
+{
+    const int sh = 29 - depth;
+    const int rnd = 1 << (sh - 1);
+    const int32_t ky[4] = {
+        c[0][0][0], c[0][1][0], c[0][2][0], rnd + (yuv_offset[0] << sh),
+    };
+    const int32_t kuv[6] = {
+        c[1][0][0], c[1][1][0], c[1][2][0], c[2][1][0], c[2][2][0],
+        rnd + (128 << (depth - 8 + sh)),
+    };
+    uint8_t *yuv0 = yuv[0], *yuv1 = yuv[1], *yuv2 = yuv[2];
+    const int16_t *rgb0 = rgb[0], *rgb1 = rgb[1], *rgb2 = rgb[2];
+    int lw;
+
+    w = AV_CEIL_RSHIFT(w, ss_w);
+    h = AV_CEIL_RSHIFT(h, ss_h);
+    lw = w << ss_w;
+    for (int y = 0; y < h; y++) {
+        luma(yuv0, rgb0, rgb1, rgb2, lw, ky);
+        if (ss_h)
+            luma(yuv0 + yuv_stride[0], rgb0 + s, rgb1 + s, rgb2 + s, lw, ky);
+        chroma(yuv1, yuv2, rgb0, rgb1, rgb2, w, s * sizeof(int16_t), kuv);
+
+        yuv0 += yuv_stride[0] << ss_h;
+        yuv1 += yuv_stride[1];
+        yuv2 += yuv_stride[2];
+        rgb0 += s << ss_h;
+        rgb1 += s << ss_h;
+        rgb2 += s << ss_h;
+    }
+}
+
+#define SS_W_444 0
+#define SS_H_444 0
+#define SS_W_422 1
+#define SS_H_422 0
+#define SS_W_420 1
+#define SS_H_420 1
+#define ROW_444  444
+#define ROW_422  422
+#define ROW_420  422
+
+#define YUV2RGB_FN2(ss, depth, row_ss)                                          \
+static void yuv2rgb_##ss##p##depth##_rvv(int16_t *rgb[3], ptrdiff_t rgb_stride, \
+                                         uint8_t *yuv[3],                       \
+                                         const ptrdiff_t yuv_stride[3],         \
+                                         int w, int h,                          \
+                                         const int16_t c[3][3][8],              \
+                                         const int16_t yuv_offset[8])           \
+{                                                                               \
+    yuv2rgb_rvv(rgb, rgb_stride, yuv, yuv_stride, w, h, c, yuv_offset,         \
+                SS_W_##ss, SS_H_##ss,                                           \
+                ff_colorspace_yuv2rgb_##row_ss##p##depth##_row_rvv);            \
+}
+#define YUV2RGB_FN(ss, depth, row_ss) YUV2RGB_FN2(ss, depth, row_ss)
+
+#define YUV2YUV_FN2(ss, idepth, odepth, row_ss)                                 \
+static void yuv2yuv_##ss##p##idepth##to##odepth##_rvv(uint8_t *dst[3],        \
+                                         const ptrdiff_t dst_stride[3],         \
+                                         uint8_t *src[3],                       \
+                                         const ptrdiff_t src_stride[3],         \
+                                         int w, int h,                          \
+                                         const int16_t c[3][3][8],              \
+                                         const int16_t yuv_offset[2][8])        \
+{                                                                               \
+    yuv2yuv_rvv(dst, dst_stride, src, src_stride, w, h, c, yuv_offset,         \
+                idepth, odepth, SS_W_##ss, SS_H_##ss,                           \
+                ff_colorspace_yuv2yuv_##row_ss##p##idepth##to##odepth##_row_rvv); \
+}
+#define YUV2YUV_FN(ss, idepth, odepth, row_ss) \
+    YUV2YUV_FN2(ss, idepth, odepth, row_ss)
+
+#define RGB2YUV_FN(ss, depth)                                                   \
+static void rgb2yuv_##ss##p##depth##_rvv(uint8_t *yuv[3],                       \
+                                         const ptrdiff_t yuv_stride[3],         \
+                                         int16_t *rgb[3], ptrdiff_t s,          \
+                                         int w, int h,                          \
+                                         const int16_t c[3][3][8],              \
+                                         const int16_t yuv_offset[8])           \
+{                                                                               \
+    rgb2yuv_rvv(yuv, yuv_stride, rgb, s, w, h, c, yuv_offset, depth,           \
+                SS_W_##ss, SS_H_##ss,                                           \
+                ff_colorspace_rgb2yuv_luma_p##depth##_row_rvv,                  \
+                ff_colorspace_rgb2yuv_chroma_##ss##p##depth##_row_rvv);         \
+}
+
+#define FNS(ss)                                 \
+    YUV2RGB_FN(ss,  8, ROW_##ss)                \
+    YUV2RGB_FN(ss, 10, ROW_##ss)                \
+    YUV2RGB_FN(ss, 12, ROW_##ss)                \
+    YUV2YUV_FN(ss,  8,  8, ROW_##ss)            \
+    YUV2YUV_FN(ss,  8, 10, ROW_##ss)            \
+    YUV2YUV_FN(ss,  8, 12, ROW_##ss)            \
+    YUV2YUV_FN(ss, 10,  8, ROW_##ss)            \
+    YUV2YUV_FN(ss, 10, 10, ROW_##ss)            \
+    YUV2YUV_FN(ss, 10, 12, ROW_##ss)            \
+    YUV2YUV_FN(ss, 12,  8, ROW_##ss)            \
+    YUV2YUV_FN(ss, 12, 10, ROW_##ss)            \
+    YUV2YUV_FN(ss, 12, 12, ROW_##ss)            \
+    RGB2YUV_FN(ss,  8)                          \
+    RGB2YUV_FN(ss, 10)                          \
+    RGB2YUV_FN(ss, 12)
+
+#if HAVE_RVV && (__riscv_xlen == 64)
+FNS(444)
+FNS(422)
+FNS(420)
+
+static void multiply3x3_rvv(int16_t *buf[3], ptrdiff_t stride,
+                            int w, int h, const int16_t m[3][3][8])
+{
+    int16_t *buf0 = buf[0], *buf1 = buf[1], *buf2 = buf[2];
+
+    for (int y = 0; y < h; y++) {
+        ff_colorspace_multiply3x3_row_rvv(buf0, buf1, buf2, w, m);
+        buf0 += stride;
+        buf1 += stride;
+        buf2 += stride;
+    }
+}
+#endif
+
+av_cold void ff_colorspacedsp_riscv_init(ColorSpaceDSPContext *dsp)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+#define init_fns(ss) \
+        dsp->yuv2rgb[BPP_8 ][SS_##ss] = yuv2rgb_##ss##p8_rvv;         \
+        dsp->yuv2rgb[BPP_10][SS_##ss] = yuv2rgb_##ss##p10_rvv;        \
+        dsp->yuv2rgb[BPP_12][SS_##ss] = yuv2rgb_##ss##p12_rvv;        \
+        dsp->rgb2yuv[BPP_8 ][SS_##ss] = rgb2yuv_##ss##p8_rvv;         \
+        dsp->rgb2yuv[BPP_10][SS_##ss] = rgb2yuv_##ss##p10_rvv;        \
+        dsp->rgb2yuv[BPP_12][SS_##ss] = rgb2yuv_##ss##p12_rvv;        \
+        dsp->yuv2yuv[BPP_8 ][BPP_8 ][SS_##ss] = yuv2yuv_##ss##p8to8_rvv;   \
+        dsp->yuv2yuv[BPP_8 ][BPP_10][SS_##ss] = yuv2yuv_##ss##p8to10_rvv;  \
+        dsp->yuv2yuv[BPP_8 ][BPP_12][SS_##ss] = yuv2yuv_##ss##p8to12_rvv;  \
+        dsp->yuv2yuv[BPP_10][BPP_8 ][SS_##ss] = yuv2yuv_##ss##p10to8_rvv;  \
+        dsp->yuv2yuv[BPP_10][BPP_10][SS_##ss] = yuv2yuv_##ss##p10to10_rvv; \
+        dsp->yuv2yuv[BPP_10][BPP_12][SS_##ss] = yuv2yuv_##ss##p10to12_rvv; \
+        dsp->yuv2yuv[BPP_12][BPP_8 ][SS_##ss] = yuv2yuv_##ss##p12to8_rvv;  \
+        dsp->yuv2yuv[BPP_12][BPP_10][SS_##ss] = yuv2yuv_##ss##p12to10_rvv; \
+        dsp->yuv2yuv[BPP_12][BPP_12][SS_##ss] = yuv2yuv_##ss##p12to12_rvv
+
+        init_fns(444);
+        init_fns(422);
+        init_fns(420);
+#undef init_fns
+
+        dsp->multiply3x3 = multiply3x3_rvv;
+    }
+#endif
+}
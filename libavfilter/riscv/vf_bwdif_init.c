@@ -0,0 +1,66 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/bwdifdsp.h"
+
+#define BWDIF_FUNCS(bpc) \
+void ff_bwdif_filter_intra##bpc##_rvv(void *dst, const void *cur, int w, \
+                                      int prefs, int mrefs, int prefs3, \
+                                      int mrefs3, int parity, int clip_max); \
+void ff_bwdif_filter_line##bpc##_rvv(void *dst, const void *prev, \
+                                     const void *cur, const void *next, \
+                                     int w, int prefs, int mrefs, \
+                                     int prefs2, int mrefs2, int prefs3, \
+                                     int mrefs3, int prefs4, int mrefs4, \
+                                     int parity, int clip_max); \
+void ff_bwdif_filter_edge##bpc##_rvv(void *dst, const void *prev, \
+                                     const void *cur, const void *next, \
+                                     int w, int prefs, int mrefs, \
+                                     int prefs2, int mrefs2, int parity, \
+                                     int clip_max, int spat);
+
+BWDIF_FUNCS(8)
+BWDIF_FUNCS(16)
+
+av_cold void ff_bwdif_init_riscv(BWDIFDSPContext *s, int bit_depth)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        if (bit_depth > 8) {
+            s->filter_intra = ff_bwdif_filter_intra16_rvv;
+#if (__riscv_xlen == 64)
+            s->filter_line  = ff_bwdif_filter_line16_rvv;
+            s->filter_edge  = ff_bwdif_filter_edge16_rvv;
+#endif
+        } else {
+            s->filter_intra = ff_bwdif_filter_intra8_rvv;
+#if (__riscv_xlen == 64)
+            s->filter_line  = ff_bwdif_filter_line8_rvv;
+            s->filter_edge  = ff_bwdif_filter_edge8_rvv;
+#endif
+        }
+    }
+#endif
+}
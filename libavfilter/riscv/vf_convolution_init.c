@@ -0,0 +1,64 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/convolution.h"
+
+void ff_filter_3x3_rvv(uint8_t *dst, int width,
+                       float rdiv, float bias, const int *const matrix,
+                       const uint8_t *c[], int peak, int radius,
+                       int dstride, int stride, int size);
+void ff_filter_5x5_rvv(uint8_t *dst, int width,
+                       float rdiv, float bias, const int *const matrix,
+                       const uint8_t *c[], int peak, int radius,
+                       int dstride, int stride, int size);
+void ff_filter_sobel_rvv(uint8_t *dst, int width,
+                         float scale, float delta, const int *const matrix,
+                         const uint8_t *c[], int peak, int radius,
+                         int dstride, int stride, int size);
+
+av_cold void ff_convolution_init_riscv(ConvolutionContext *s)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_F32) && s->depth == 8) {
+        for (int i = 0; i < 4; i++) {
+            if (s->mode[i] != MATRIX_SQUARE)
+                continue;
+            if (s->matrix_length[i] == 9)
+                s->filter[i] = ff_filter_3x3_rvv;
+            else if (s->matrix_length[i] == 25)
+                s->filter[i] = ff_filter_5x5_rvv;
+        }
+    }
+#endif
+}
+
+av_cold void ff_sobel_init_riscv(ConvolutionContext *s, int depth, int nb_planes)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_F32) && depth == 8)
+        for (int i = 0; i < nb_planes; i++)
+            s->filter[i] = ff_filter_sobel_rvv;
+#endif
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/vf_eq.h"
+
+void ff_eq_process_line_rvv(const uint8_t *src, uint8_t *dst, int contrast,
+                            int brightness, int w);
+
+#if HAVE_RVV
+/* Same fixed-point parameters as process_c(), without the 16-bit limit. */
+static void process_rvv(EQParameters *param, uint8_t *dst, int dst_stride,
+                        const uint8_t *src, int src_stride, int w, int h)
+{
+    int contrast = (int) (param->contrast * 256 * 16);
+    int brightness = ((int) (100.0 * param->brightness + 100.0) * 511)
+                     / 200 - 128 - contrast / 32;
+
+    while (h--) {
+        ff_eq_process_line_rvv(src, dst, contrast, brightness, w);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+#endif
+
+av_cold void ff_eq_init_riscv(EQContext *eq)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if (flags & AV_CPU_FLAG_RVV_I32)
+        eq->process = process_rvv;
+#endif
+}
@@ -0,0 +1,43 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/gblur.h"
+
+void ff_horiz_slice_rvv(float *buffer, int width, int height, int steps,
+                        float nu, float bscale, float *localbuf);
+void ff_verti_slice_rvv(float *buffer, int width, int height,
+                        int slice_start, int slice_end, int steps,
+                        float nu, float bscale);
+void ff_postscale_slice_rvv(float *buffer, int length, float postscale,
+                            float min, float max);
+
+av_cold void ff_gblur_init_riscv(GBlurContext *s)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_F32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        s->horiz_slice = ff_horiz_slice_rvv;
+        s->verti_slice = ff_verti_slice_rvv;
+        s->postscale_slice = ff_postscale_slice_rvv;
+    }
+#endif
+}
@@ -0,0 +1,42 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/psnr.h"
+
+uint64_t ff_sse_line_8bit_rvv(const uint8_t *buf, const uint8_t *ref, int w);
+uint64_t ff_sse_line_16bit_rvv(const uint8_t *buf, const uint8_t *ref, int w);
+
+av_cold void ff_psnr_init_riscv(PSNRDSPContext *dsp, int bpp)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if (bpp <= 8) {
+        if (flags & AV_CPU_FLAG_RVV_I32)
+            dsp->sse_line = ff_sse_line_8bit_rvv;
+    } else {
+        if (flags & AV_CPU_FLAG_RVV_I64)
+            dsp->sse_line = ff_sse_line_16bit_rvv;
+    }
+#endif
+}
@@ -0,0 +1,48 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/threshold.h"
+
+#define THRESHOLD_FUNC(depth)                                                 \
+void ff_threshold##depth##_rvv(const uint8_t *in, const uint8_t *threshold,  \
+                               const uint8_t *min, const uint8_t *max,       \
+                               uint8_t *out,                                 \
+                               ptrdiff_t ilinesize, ptrdiff_t tlinesize,     \
+                               ptrdiff_t flinesize, ptrdiff_t slinesize,     \
+                               ptrdiff_t olinesize,                          \
+                               int w, int h);
+
+THRESHOLD_FUNC(8)
+THRESHOLD_FUNC(16)
+
+av_cold void ff_threshold_init_riscv(ThresholdContext *s)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        if (s->depth == 8)
+            s->threshold = ff_threshold8_rvv;
+        else
+            s->threshold = ff_threshold16_rvv;
+    }
+#endif
+}
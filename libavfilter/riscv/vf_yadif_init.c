@@ -0,0 +1,45 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavfilter/yadif.h"
+
+void ff_yadif_filter_line8_rvv(void *dst, void *prev, void *cur, void *next,
+                               int w, int prefs, int mrefs, int parity,
+                               int mode);
+void ff_yadif_filter_line16_rvv(void *dst, void *prev, void *cur, void *next,
+                                int w, int prefs, int mrefs, int parity,
+                                int mode);
+
+av_cold void ff_yadif_init_riscv(YADIFContext *yadif)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+    int bit_depth = (!yadif->csp) ? 8
+                                  : yadif->csp->comp[0].depth;
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        if (bit_depth > 8)
+            yadif->filter_line = ff_yadif_filter_line16_rvv;
+        else
+            yadif->filter_line = ff_yadif_filter_line8_rvv;
+    }
+#endif
+}
@@ -196,6 +196,8 @@ static av_unused void ff_blend_init(FilterParams *param, int depth)
 
 #if ARCH_X86
     ff_blend_init_x86(param, depth);
+#elif ARCH_RISCV
+    ff_blend_init_riscv(param, depth);
 #endif
 }
 
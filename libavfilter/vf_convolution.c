@@ -799,6 +799,8 @@ static int param_init(AVFilterContext *ctx)
         }
 #if CONFIG_CONVOLUTION_FILTER && ARCH_X86_64
         ff_convolution_init_x86(s);
+#elif CONFIG_CONVOLUTION_FILTER && ARCH_RISCV
+        ff_convolution_init_riscv(s);
 #endif
     } else if (!strcmp(ctx->filter->name, "prewitt")) {
         if (s->depth > 8)
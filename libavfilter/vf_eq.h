@@ -123,12 +123,15 @@ static void process_c(EQParameters *param, uint8_t *dst, int dst_stride,
 }
 
 void ff_eq_init_x86(EQContext *eq);
+void ff_eq_init_riscv(EQContext *eq);
 
 static av_unused void ff_eq_init(EQContext *eq)
 {
     eq->process = process_c;
 #if ARCH_X86
     ff_eq_init_x86(eq);
+#elif ARCH_RISCV
+    ff_eq_init_riscv(eq);
 #endif
 }
 
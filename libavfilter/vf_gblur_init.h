@@ -117,6 +117,8 @@ static av_unused void ff_gblur_init(GBlurContext *s)
     s->postscale_slice = postscale_c;
 #if ARCH_X86
     ff_gblur_init_x86(s);
+#elif ARCH_RISCV
+    ff_gblur_init_riscv(s);
 #endif
 }
 
@@ -40,6 +40,7 @@ typedef struct NLMeansDSPContext {
 } NLMeansDSPContext;
 
 void ff_nlmeans_init_aarch64(NLMeansDSPContext *dsp);
+void ff_nlmeans_init_riscv(NLMeansDSPContext *dsp);
 void ff_nlmeans_init_x86(NLMeansDSPContext *dsp);
 
 #endif /* AVFILTER_NLMEANS_H */
@@ -131,6 +131,8 @@ static av_unused void ff_nlmeans_init(NLMeansDSPContext *dsp)
 
 #if ARCH_AARCH64
     ff_nlmeans_init_aarch64(dsp);
+#elif ARCH_RISCV
+    ff_nlmeans_init_riscv(dsp);
 #elif ARCH_X86
     ff_nlmeans_init_x86(dsp);
 #endif
@@ -360,7 +360,9 @@ static int config_input_ref(AVFilterLink *inlink)
     s->average_max = lrint(average_max);
 
     s->dsp.sse_line = desc->comp[0].depth > 8 ? sse_line_16bit : sse_line_8bit;
-#if ARCH_X86
+#if ARCH_RISCV
+    ff_psnr_init_riscv(&s->dsp, desc->comp[0].depth);
+#elif ARCH_X86
     ff_psnr_init_x86(&s->dsp, desc->comp[0].depth);
 #endif
 
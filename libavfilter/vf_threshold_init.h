@@ -86,6 +86,8 @@ static av_unused void ff_threshold_init(ThresholdContext *s)
 
 #if ARCH_X86
     ff_threshold_init_x86(s);
+#elif ARCH_RISCV
+    ff_threshold_init_riscv(s);
 #endif
 }
 
@@ -318,6 +318,8 @@ static int config_input(AVFilterLink *inlink)
 
 #if ARCH_X86
     ff_w3fdif_init_x86(&s->dsp, depth);
+#elif ARCH_RISCV
+    ff_w3fdif_init_riscv(&s->dsp, depth);
 #endif
 
     return 0;
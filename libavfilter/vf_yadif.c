@@ -291,6 +291,8 @@ static int config_output(AVFilterLink *outlink)
 
 #if ARCH_X86
     ff_yadif_init_x86(s);
+#elif ARCH_RISCV
+    ff_yadif_init_riscv(s);
 #endif
 
     return 0;
@@ -44,5 +44,6 @@ typedef struct W3FDIFDSPContext {
 } W3FDIFDSPContext;
 
 void ff_w3fdif_init_x86(W3FDIFDSPContext *dsp, int depth);
+void ff_w3fdif_init_riscv(W3FDIFDSPContext *dsp, int depth);
 
 #endif /* AVFILTER_W3FDIF_H */
@@ -30,6 +30,10 @@
 #include "macros.h"
 #include "mem.h"
 
+#if ARCH_RISCV
+#include "riscv/aes.h"
+#endif
+
 const int av_aes_size= sizeof(AVAES);
 
 struct AVAES *av_aes_alloc(void)
@@ -256,6 +260,11 @@ int av_aes_init(AVAES *a, const uint8_t *key, int key_bits, int decrypt)
         memcpy((unsigned char*)a->round_key + t, tk, KC * 4);
     }
 
+#if ARCH_RISCV
+    if (ff_aes_init_riscv(a, decrypt))
+        return 0;
+#endif
+
     if (decrypt) {
         for (i = 1; i < rounds; i++) {
             av_aes_block tmp[3];
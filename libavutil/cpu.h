@@ -90,6 +90,11 @@
 #define AV_CPU_FLAG_RVV_F64      (1 << 6) ///< Vectors of double's
 #define AV_CPU_FLAG_RVB_BASIC    (1 << 7) ///< Basic bit-manipulations
 #define AV_CPU_FLAG_RVB_ADDR     (1 << 8) ///< Address bit-manipulations
+#define AV_CPU_FLAG_RVB_CLMUL    (1 << 9) ///< Carry-less multiplication
+#define AV_CPU_FLAG_RV_ZVBC      (1 <<10) ///< Vector carry-less multiplication
+#define AV_CPU_FLAG_RV_ZVKNED    (1 <<11) ///< Vector AES
+#define AV_CPU_FLAG_RV_ZVKNHA    (1 <<12) ///< Vector SHA-256
+#define AV_CPU_FLAG_RV_ZVKNHB    (1 <<13) ///< Vector SHA-256 and SHA-512
 
 /**
  * Return the flags which specify extensions supported by the CPU.
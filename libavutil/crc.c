@@ -26,6 +26,10 @@
 #include "crc.h"
 #include "error.h"
 
+#if ARCH_RISCV
+#include "riscv/crc.h"
+#endif
+
 #if CONFIG_HARDCODED_TABLES
 static const AVCRC av_crc_table[AV_CRC_MAX][257] = {
     [AV_CRC_8_ATM] = {
@@ -371,8 +375,21 @@ int av_crc_init(AVCRC *ctx, int le, int bits, uint32_t poly, int ctx_size)
     return 0;
 }
 
+#if ARCH_RISCV
+static ff_crc_riscv_fn crc_riscv[AV_CRC_MAX];
+static AVOnce crc_riscv_once = AV_ONCE_INIT;
+
+static void crc_init_riscv_once(void)
+{
+    ff_crc_init_riscv(crc_riscv);
+}
+#endif
+
 const AVCRC *av_crc_get_table(AVCRCId crc_id)
 {
+#if ARCH_RISCV
+    ff_thread_once(&crc_riscv_once, crc_init_riscv_once);
+#endif
 #if !CONFIG_HARDCODED_TABLES
     switch (crc_id) {
     case AV_CRC_8_ATM:      CRC_INIT_TABLE_ONCE(AV_CRC_8_ATM); break;
@@ -394,6 +411,14 @@ uint32_t av_crc(const AVCRC *ctx, uint32_t crc,
 {
     const uint8_t *end = buffer + length;
 
+#if ARCH_RISCV
+    uintptr_t crc_id = ((uintptr_t) ctx - (uintptr_t) av_crc_table) /
+                       sizeof(av_crc_table[0]);
+
+    if (crc_id < AV_CRC_MAX && ctx == av_crc_table[crc_id] && crc_riscv[crc_id])
+        buffer = crc_riscv[crc_id](ctx, crc_id, &crc, buffer, length);
+#endif
+
 #if !CONFIG_SMALL
     if (!ctx[256]) {
         while (((intptr_t) buffer & 3) && buffer < end)
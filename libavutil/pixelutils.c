@@ -28,6 +28,7 @@
 #include "attributes.h"
 #include "macros.h"
 
+#include "riscv/pixelutils.h"
 #include "x86/pixelutils.h"
 
 static av_always_inline int sad_wxh(const uint8_t *src1, ptrdiff_t stride1,
@@ -86,7 +87,9 @@ av_pixelutils_sad_fn av_pixelutils_get_sad_fn(int w_bits, int h_bits, int aligne
     if (w_bits != h_bits) // only squared sad for now
         return NULL;
 
-#if ARCH_X86
+#if ARCH_RISCV
+    ff_pixelutils_sad_init_riscv(sad, aligned);
+#elif ARCH_X86
     ff_pixelutils_sad_init_x86(sad, aligned);
 #endif
 
@@ -0,0 +1,34 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef AVUTIL_RISCV_AES_H
+#define AVUTIL_RISCV_AES_H
+
+#include "libavutil/aes_internal.h"
+
+/**
+ * Select an accelerated crypt function, if the CPU supports one.
+ *
+ * This is called with the key schedule in its natural order, before the
+ * transformations specific to the C code.
+ * @return 1 if a->crypt was set and the key schedule must be left as is,
+ *         0 otherwise
+ */
+int ff_aes_init_riscv(AVAES *a, int decrypt);
+
+#endif /* AVUTIL_RISCV_AES_H */
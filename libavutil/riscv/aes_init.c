@@ -0,0 +1,46 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/aes_internal.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "aes.h"
+
+void ff_aes_encrypt_rvv(AVAES *a, uint8_t *dst, const uint8_t *src,
+                        int count, uint8_t *iv, int rounds);
+void ff_aes_decrypt_rvv(AVAES *a, uint8_t *dst, const uint8_t *src,
+                        int count, uint8_t *iv, int rounds);
+
+av_cold int ff_aes_init_riscv(AVAES *a, int decrypt)
+{
+#if HAVE_RV_ZVK
+    int flags = av_get_cpu_flags();
+
+    /* Zvkned operates on 128-bit element groups. */
+    if ((flags & AV_CPU_FLAG_RV_ZVKNED) && (flags & AV_CPU_FLAG_RVV_I32) &&
+        ff_rv_vlen_least(128)) {
+        a->crypt = decrypt ? ff_aes_decrypt_rvv : ff_aes_encrypt_rvv;
+        return 1;
+    }
+#endif
+    return 0;
+}
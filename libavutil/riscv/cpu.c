@@ -27,6 +27,21 @@
 #include <sys/auxv.h>
 #define HWCAP_RV(letter) (1ul << ((letter) - 'A'))
 #endif
+#if HAVE_SYS_HWPROBE_H
+#include <sys/hwprobe.h>
+#elif HAVE_ASM_HWPROBE_H
+#include <asm/hwprobe.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int __riscv_hwprobe(struct riscv_hwprobe *pairs, size_t pair_count,
+                           size_t cpu_count, unsigned long *cpus,
+                           unsigned int flags)
+{
+    return syscall(__NR_riscv_hwprobe, pairs, pair_count, cpu_count, cpus,
+                   flags);
+}
+#endif
 
 int ff_get_cpu_flags_riscv(void)
 {
@@ -49,6 +64,45 @@ int ff_get_cpu_flags_riscv(void)
              | AV_CPU_FLAG_RVV_F32 | AV_CPU_FLAG_RVV_F64;
 #endif
 
+#if HAVE_SYS_HWPROBE_H || HAVE_ASM_HWPROBE_H
+    /* The hardware capabilities only report single-letter extensions. */
+    {
+        struct riscv_hwprobe pair = { RISCV_HWPROBE_KEY_IMA_EXT_0, 0 };
+
+        if (__riscv_hwprobe(&pair, 1, 0, NULL, 0) == 0) {
+#ifdef RISCV_HWPROBE_EXT_ZBA
+            if (pair.value & RISCV_HWPROBE_EXT_ZBA)
+                ret |= AV_CPU_FLAG_RVB_ADDR;
+#endif
+#ifdef RISCV_HWPROBE_EXT_ZBB
+            if (pair.value & RISCV_HWPROBE_EXT_ZBB)
+                ret |= AV_CPU_FLAG_RVB_BASIC;
+#endif
+#ifdef RISCV_HWPROBE_EXT_ZBC
+            if (pair.value & RISCV_HWPROBE_EXT_ZBC)
+                ret |= AV_CPU_FLAG_RVB_CLMUL;
+#endif
+#ifdef RISCV_HWPROBE_EXT_ZVBC
+            if (pair.value & RISCV_HWPROBE_EXT_ZVBC)
+                ret |= AV_CPU_FLAG_RV_ZVBC;
+#endif
+#ifdef RISCV_HWPROBE_EXT_ZVKNED
+            if (pair.value & RISCV_HWPROBE_EXT_ZVKNED)
+                ret |= AV_CPU_FLAG_RV_ZVKNED;
+#endif
+#ifdef RISCV_HWPROBE_EXT_ZVKNHA
+            if (pair.value & RISCV_HWPROBE_EXT_ZVKNHA)
+                ret |= AV_CPU_FLAG_RV_ZVKNHA;
+#endif
+#ifdef RISCV_HWPROBE_EXT_ZVKNHB
+            /* Zvknhb is a superset of Zvknha. */
+            if (pair.value & RISCV_HWPROBE_EXT_ZVKNHB)
+                ret |= AV_CPU_FLAG_RV_ZVKNHA | AV_CPU_FLAG_RV_ZVKNHB;
+#endif
+        }
+    }
+#endif
+
 #ifdef __riscv_i
     ret |= AV_CPU_FLAG_RVI;
 #endif
@@ -65,6 +119,9 @@ int ff_get_cpu_flags_riscv(void)
 #ifdef __riscv_zbb
     ret |= AV_CPU_FLAG_RVB_BASIC;
 #endif
+#ifdef __riscv_zbc
+    ret |= AV_CPU_FLAG_RVB_CLMUL;
+#endif
 
     /* If RV-V is enabled statically at compile-time, check the details. */
 #ifdef __riscv_vector
@@ -78,6 +135,18 @@ int ff_get_cpu_flags_riscv(void)
     ret |= AV_CPU_FLAG_RVV_F64;
 #endif
 #endif
+#ifdef __riscv_zvbc
+    ret |= AV_CPU_FLAG_RV_ZVBC;
+#endif
+#ifdef __riscv_zvkned
+    ret |= AV_CPU_FLAG_RV_ZVKNED;
+#endif
+#ifdef __riscv_zvknha
+    ret |= AV_CPU_FLAG_RV_ZVKNHA;
+#endif
+#ifdef __riscv_zvknhb
+    ret |= AV_CPU_FLAG_RV_ZVKNHA | AV_CPU_FLAG_RV_ZVKNHB;
+#endif
 #endif
 
     return ret;
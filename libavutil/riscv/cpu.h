@@ -41,5 +41,18 @@ static inline size_t ff_get_rv_vlenb(void)
         ".option pop\n" : "=r" (vlenb));
     return vlenb;
 }
+
+/**
+ * Checks that the vector bit-size is at least the given value.
+ * This is undefined behaviour if vectors are not implemented.
+ */
+static inline int ff_rv_vlen_least(unsigned int bits)
+{
+#ifdef __riscv_v_min_vlen
+    if (bits <= __riscv_v_min_vlen)
+        return 1;
+#endif
+    return bits <= 8 * ff_get_rv_vlenb();
+}
 #endif
 #endif
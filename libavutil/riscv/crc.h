@@ -0,0 +1,44 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef AVUTIL_RISCV_CRC_H
+#define AVUTIL_RISCV_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "libavutil/crc.h"
+
+/**
+ * Process the bulk of a buffer with carry-less multiplications.
+ *
+ * @param ctx    the table of crc_id, as returned by av_crc_get_table()
+ * @param crc    the CRC so far, updated on return
+ * @return pointer to the first byte not processed yet
+ */
+typedef const uint8_t *(*ff_crc_riscv_fn)(const AVCRC *ctx, AVCRCId crc_id,
+                                          uint32_t *crc, const uint8_t *buffer,
+                                          size_t length);
+
+/**
+ * Set the folding function of each predefined CRC that the CPU supports.
+ * Entries of unsupported CRCs are left untouched.
+ */
+void ff_crc_init_riscv(ff_crc_riscv_fn fns[AV_CRC_MAX]);
+
+#endif /* AVUTIL_RISCV_CRC_H */
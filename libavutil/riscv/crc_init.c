@@ -0,0 +1,179 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/crc.h"
+#include "libavutil/mem_internal.h"
+#include "crc.h"
+
+void ff_crc_fold_le_rvb(uint8_t *dst, uint32_t crc, const uint8_t *buf,
+                        size_t len, const uint64_t k[2]);
+void ff_crc_fold_be_rvb(uint8_t *dst, uint32_t crc, const uint8_t *buf,
+                        size_t len, const uint64_t k[2]);
+size_t ff_crc_fold_le_rvv(uint8_t *dst, uint32_t crc, const uint8_t *buf,
+                          size_t len, const uint64_t k[4]);
+size_t ff_crc_fold_be_rvv(uint8_t *dst, uint32_t crc, const uint8_t *buf,
+                          size_t len, const uint64_t k[4]);
+
+#if HAVE_RV && (__riscv_xlen >= 64)
+/*
+ * Folding constants: x^192 and x^128 mod P for the scalar loop, then
+ * x^(64 * vl) mod P for vl = 2, 4, 8 and 16 for the vector loop.
+ * For the bit-reflected CRCs, they are reflected and divided by x.
+ */
+static const struct {
+    uint8_t le;
+    uint64_t k[6];
+} crc_fold_consts[AV_CRC_MAX] = {
+    [AV_CRC_8_ATM] = { 0, {
+        0x0000000000000026, 0x0000000000000002,
+        0x0000000000000002, 0x0000000000000004,
+        0x0000000000000010, 0x0000000000000007,
+    } },
+    [AV_CRC_8_EBU] = { 0, {
+        0x0000000000000082, 0x0000000000000085,
+        0x0000000000000085, 0x0000000000000002,
+        0x0000000000000004, 0x0000000000000010,
+    } },
+    [AV_CRC_16_ANSI] = { 0, {
+        0x0000000000001666, 0x0000000000000106,
+        0x0000000000000106, 0x0000000000008011,
+        0x0000000000008107, 0x0000000000000016,
+    } },
+    [AV_CRC_16_CCITT] = { 0, {
+        0x000000000000650B, 0x000000000000AEFC,
+        0x000000000000AEFC, 0x0000000000008E29,
+        0x00000000000013FC, 0x00000000000036C4,
+    } },
+    [AV_CRC_24_IEEE] = { 0, {
+        0x0000000000B22B31, 0x00000000006243DA,
+        0x00000000006243DA, 0x0000000000CB800E,
+        0x00000000007DB43E, 0x0000000000DEF23C,
+    } },
+    [AV_CRC_32_IEEE] = { 0, {
+        0x00000000C5B9CD4C, 0x00000000E8A45605,
+        0x00000000E8A45605, 0x0000000075BE46B7,
+        0x00000000E6228B11, 0x00000000567FDDEB,
+    } },
+    [AV_CRC_32_IEEE_LE] = { 1, {
+        0x65673B4600000000, 0x9BA54C6F00000000,
+        0x9BA54C6F00000000, 0x01B5FD1D00000000,
+        0xCAD38E8F00000000, 0x7406FA9500000000,
+    } },
+    [AV_CRC_16_ANSI_LE] = { 1, {
+        0xCCD0000000000000, 0xC100000000000000,
+        0xC100000000000000, 0x5001000000000000,
+        0x8101000000000000, 0xD000000000000000,
+    } },
+};
+
+static uint32_t crc_bytes(const AVCRC *ctx, uint32_t crc,
+                          const uint8_t *buf, size_t len)
+{
+    while (len--)
+        crc = ctx[((uint8_t) crc) ^ *buf++] ^ (crc >> 8);
+    return crc;
+}
+
+static av_always_inline
+const uint8_t *crc_fold(const AVCRC *ctx, AVCRCId crc_id, uint32_t *crc,
+                        const uint8_t *buffer, size_t length, int zvbc)
+{
+    const uint64_t *k = crc_fold_consts[crc_id].k;
+    int le = crc_fold_consts[crc_id].le;
+    DECLARE_ALIGNED(16, uint8_t, folded)[128];
+    size_t head, len;
+
+    if (length < 64)
+        return buffer;
+
+    /* The folding loops load aligned 64-bit words. */
+    head = -(uintptr_t)buffer & 7;
+    *crc = crc_bytes(ctx, *crc, buffer, head);
+    buffer += head;
+    length -= head;
+
+#if HAVE_RV_ZVBC
+    if (zvbc && length >= 256) {
+        size_t size = (le ? ff_crc_fold_le_rvv
+                          : ff_crc_fold_be_rvv)(folded, *crc, buffer,
+                                                length, k + 2);
+
+        len = length - length % size;
+        buffer += len;
+        length -= len;
+        /* Continue with the folded remainder as the start of the message. */
+        (le ? ff_crc_fold_le_rvb : ff_crc_fold_be_rvb)(folded, 0, folded,
+                                                       size, k);
+        *crc = crc_bytes(ctx, 0, folded, 16);
+    }
+#endif
+
+    len = length & ~(size_t)15;
+    if (len) {
+        (le ? ff_crc_fold_le_rvb : ff_crc_fold_be_rvb)(folded, *crc, buffer,
+                                                       len, k);
+        *crc = crc_bytes(ctx, 0, folded, 16);
+        buffer += len;
+    }
+    return buffer;
+}
+
+static const uint8_t *crc_fold_rvb(const AVCRC *ctx, AVCRCId crc_id,
+                                   uint32_t *crc, const uint8_t *buffer,
+                                   size_t length)
+{
+    return crc_fold(ctx, crc_id, crc, buffer, length, 0);
+}
+
+#if HAVE_RV_ZVBC
+static const uint8_t *crc_fold_rvv(const AVCRC *ctx, AVCRCId crc_id,
+                                   uint32_t *crc, const uint8_t *buffer,
+                                   size_t length)
+{
+    return crc_fold(ctx, crc_id, crc, buffer, length, 1);
+}
+#endif
+#endif
+
+av_cold void ff_crc_init_riscv(ff_crc_riscv_fn fns[AV_CRC_MAX])
+{
+#if HAVE_RV && (__riscv_xlen >= 64)
+    int flags = av_get_cpu_flags();
+
+    if (!(flags & AV_CPU_FLAG_RVB_CLMUL))
+        return;
+
+    for (int i = 0; i < AV_CRC_MAX; i++) {
+        /* The big-endian CRCs need Zbb to byte-swap. */
+        if (!crc_fold_consts[i].le && !(flags & AV_CPU_FLAG_RVB_BASIC))
+            continue;
+
+        fns[i] = crc_fold_rvb;
+#if HAVE_RV_ZVBC
+        if ((flags & AV_CPU_FLAG_RV_ZVBC) && (flags & AV_CPU_FLAG_RVB_BASIC))
+            fns[i] = crc_fold_rvv;
+#endif
+    }
+#endif
+}
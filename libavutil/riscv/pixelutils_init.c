@@ -0,0 +1,51 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "pixelutils.h"
+
+int ff_pixelutils_sad_4x4_rvv(const uint8_t *src1, ptrdiff_t stride1,
+                              const uint8_t *src2, ptrdiff_t stride2);
+int ff_pixelutils_sad_8x8_rvv(const uint8_t *src1, ptrdiff_t stride1,
+                              const uint8_t *src2, ptrdiff_t stride2);
+int ff_pixelutils_sad_16x16_rvv(const uint8_t *src1, ptrdiff_t stride1,
+                                const uint8_t *src2, ptrdiff_t stride2);
+int ff_pixelutils_sad_32x32_rvv(const uint8_t *src1, ptrdiff_t stride1,
+                                const uint8_t *src2, ptrdiff_t stride2);
+
+av_cold void ff_pixelutils_sad_init_riscv(av_pixelutils_sad_fn *sad,
+                                          int aligned)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    /* Vector loads have no alignment requirement on elements of 8 bits. */
+    if ((flags & AV_CPU_FLAG_RVV_I32) && ff_rv_vlen_least(128)) {
+        sad[1] = ff_pixelutils_sad_4x4_rvv;
+        sad[2] = ff_pixelutils_sad_8x8_rvv;
+        sad[3] = ff_pixelutils_sad_16x16_rvv;
+        sad[4] = ff_pixelutils_sad_32x32_rvv;
+    }
+#endif
+}
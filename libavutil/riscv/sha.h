@@ -0,0 +1,37 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef AVUTIL_RISCV_SHA_H
+#define AVUTIL_RISCV_SHA_H
+
+#include <stdint.h>
+
+/**
+ * Override the block transform of SHA-224/256, if the CPU supports it.
+ */
+void ff_sha_init_riscv(void (**transform)(uint32_t *state,
+                                          const uint8_t buffer[64]),
+                       int bits);
+
+/**
+ * Override the block transform of SHA-384/512, if the CPU supports it.
+ */
+void ff_sha512_init_riscv(void (**transform)(uint64_t *state,
+                                             const uint8_t buffer[128]));
+
+#endif /* AVUTIL_RISCV_SHA_H */
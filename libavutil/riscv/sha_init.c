@@ -0,0 +1,57 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/riscv/cpu.h"
+#include "sha.h"
+
+void ff_sha256_transform_rvv(uint32_t *state, const uint8_t buffer[64]);
+void ff_sha512_transform_rvv(uint64_t *state, const uint8_t buffer[128]);
+
+av_cold void ff_sha_init_riscv(void (**transform)(uint32_t *state,
+                                                  const uint8_t buffer[64]),
+                               int bits)
+{
+#if HAVE_RV_ZVK
+    int flags = av_get_cpu_flags();
+
+    if (bits == 160)
+        return;
+    /* Zvknha operates on 128-bit element groups. */
+    if ((flags & AV_CPU_FLAG_RV_ZVKNHA) && (flags & AV_CPU_FLAG_RVV_I32) &&
+        ff_rv_vlen_least(128))
+        *transform = ff_sha256_transform_rvv;
+#endif
+}
+
+av_cold void ff_sha512_init_riscv(void (**transform)(uint64_t *state,
+                                                     const uint8_t buffer[128]))
+{
+#if HAVE_RV_ZVK
+    int flags = av_get_cpu_flags();
+
+    /* Zvknhb operates on 256-bit element groups, two vectors at VLEN=128. */
+    if ((flags & AV_CPU_FLAG_RV_ZVKNHB) && (flags & AV_CPU_FLAG_RVV_I64) &&
+        ff_rv_vlen_least(128))
+        *transform = ff_sha512_transform_rvv;
+#endif
+}
@@ -0,0 +1,404 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <math.h>
+#include <string.h>
+
+#define TX_FLOAT
+#include "libavutil/tx_priv.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/mathematics.h"
+
+#include "config.h"
+
+/* Sub-transforms of 2 to 1 << SR_LEVELS points */
+#define SR_LEVELS 17
+
+void ff_tx_fft_sr_permute_float_rvv(TXComplex *dst, const TXComplex *src,
+                                    const int *map, int len);
+void ff_tx_fft_sr_bf2_float_rvv(TXComplex *z, const int *offsets, int nb);
+void ff_tx_fft_sr_combine_float_rvv(TXComplex *z, const int *offsets, int nb,
+                                    int log2_len4, const TXSample *cos);
+void ff_tx_mdct_inv_pre_float_rvv(TXComplex *z, const TXSample *src,
+                                  const int *map, const TXComplex *exp,
+                                  int len2, ptrdiff_t stride);
+void ff_tx_mdct_inv_post_float_rvv(TXComplex *z, const TXComplex *exp,
+                                   int len4);
+void ff_tx_mdct_fwd_pre_float_rvv(TXComplex *z, const TXSample *src,
+                                  const int *map, const TXComplex *exp,
+                                  int len2);
+void ff_tx_mdct_fwd_post_float_rvv(TXComplex *z, const TXComplex *exp,
+                                   int len4);
+void ff_tx_rdft_post_float_rvv(TXComplex *data, const TXSample *fact,
+                               int len4);
+
+TX_DECL_FN(fft_sr,    rvv)
+TX_DECL_FN(fft_sr_ns, rvv)
+TX_DECL_FN(mdct_fwd,  rvv)
+TX_DECL_FN(mdct_inv,  rvv)
+TX_DECL_FN(rdft_r2c,  rvv)
+TX_DECL_FN(rdft_c2r,  rvv)
+
+#define SR_TABLE(len) \
+    extern TXSample TX_TAB(ff_tx_tab_ ##len)[];
+SR_TABLE(8)
+SR_TABLE(16)
+SR_TABLE(32)
+SR_TABLE(64)
+SR_TABLE(128)
+SR_TABLE(256)
+SR_TABLE(512)
+SR_TABLE(1024)
+SR_TABLE(2048)
+SR_TABLE(4096)
+SR_TABLE(8192)
+SR_TABLE(16384)
+SR_TABLE(32768)
+SR_TABLE(65536)
+SR_TABLE(131072)
+#undef SR_TABLE
+
+static const TXSample sr_tab_4[2] = { 1.0f, 0.0f };
+
+static const TXSample *const sr_tabs[SR_LEVELS] = {
+    NULL, sr_tab_4,
+    TX_TAB(ff_tx_tab_8),     TX_TAB(ff_tx_tab_16),    TX_TAB(ff_tx_tab_32),
+    TX_TAB(ff_tx_tab_64),    TX_TAB(ff_tx_tab_128),   TX_TAB(ff_tx_tab_256),
+    TX_TAB(ff_tx_tab_512),   TX_TAB(ff_tx_tab_1024),  TX_TAB(ff_tx_tab_2048),
+    TX_TAB(ff_tx_tab_4096),  TX_TAB(ff_tx_tab_8192),  TX_TAB(ff_tx_tab_16384),
+    TX_TAB(ff_tx_tab_32768), TX_TAB(ff_tx_tab_65536), TX_TAB(ff_tx_tab_131072),
+};
+
+/*
+ * The split-radix tree is walked once at init, listing the byte offsets of
+ * the sub-transforms of each size. s->tmp holds the number of sub-transforms
+ * per size, from 2 points up, followed by the offsets in the same order and,
+ * for the non-preshuffled codelet, the input permutation.
+ */
+static av_cold void sr_count(int *cnt, int len)
+{
+    if (len < 2)
+        return;
+
+    cnt[ff_log2(len) - 1]++;
+    if (len == 2)
+        return;
+
+    sr_count(cnt, len >> 1);
+    sr_count(cnt, len >> 2);
+    sr_count(cnt, len >> 2);
+}
+
+static av_cold void sr_fill(int **pos, int off, int len)
+{
+    if (len < 2)
+        return;
+
+    *pos[ff_log2(len) - 1]++ = off * sizeof(TXComplex);
+    if (len == 2)
+        return;
+
+    sr_fill(pos, off,                len >> 1);
+    sr_fill(pos, off + (len >> 1),   len >> 2);
+    sr_fill(pos, off + 3*(len >> 2), len >> 2);
+}
+
+static av_cold int sr_init(AVTXContext *s, FFTXCodeletOptions *opts,
+                           int len, int preshuffle)
+{
+    int ret, nb = 0;
+    int cnt[SR_LEVELS] = { 0 }, *pos[SR_LEVELS], *tab;
+
+    ff_tx_init_tabs_float(len);
+
+    if ((ret = ff_tx_gen_ptwo_revtab(s, preshuffle ? opts : NULL)))
+        return ret;
+
+    sr_count(cnt, len);
+    for (int i = 0; i < SR_LEVELS; i++)
+        nb += cnt[i];
+
+    tab = av_malloc((SR_LEVELS + nb + (preshuffle ? 0 : len))*sizeof(*tab));
+    if (!tab)
+        return AVERROR(ENOMEM);
+    s->tmp = (TXComplex *)tab;
+
+    memcpy(tab, cnt, sizeof(cnt));
+    pos[0] = tab + SR_LEVELS;
+    for (int i = 1; i < SR_LEVELS; i++)
+        pos[i] = pos[i - 1] + cnt[i - 1];
+    sr_fill(pos, 0, len);
+
+    /* The parent may invert s->map, so keep our own gather map. */
+    if (!preshuffle)
+        memcpy(pos[SR_LEVELS - 1], s->map, len*sizeof(*s->map));
+
+    return 0;
+}
+
+static av_cold int fft_sr_init(AVTXContext *s, const FFTXCodelet *cd,
+                               uint64_t flags, FFTXCodeletOptions *opts,
+                               int len, int inv, const void *scale)
+{
+    return sr_init(s, opts, len, 0);
+}
+
+static av_cold int fft_sr_ns_init(AVTXContext *s, const FFTXCodelet *cd,
+                                  uint64_t flags, FFTXCodeletOptions *opts,
+                                  int len, int inv, const void *scale)
+{
+    return sr_init(s, opts, len, 1);
+}
+
+static void sr_run(AVTXContext *s, TXComplex *z)
+{
+    const int *cnt = (const int *)s->tmp;
+    const int *off = cnt + SR_LEVELS;
+
+    ff_tx_fft_sr_bf2_float_rvv(z, off, cnt[0]);
+    off += cnt[0];
+
+    for (int i = 1; i < SR_LEVELS; i++) {
+        if (cnt[i])
+            ff_tx_fft_sr_combine_float_rvv(z, off, cnt[i], i - 1, sr_tabs[i]);
+        off += cnt[i];
+    }
+}
+
+void ff_tx_fft_sr_float_rvv(AVTXContext *s, void *_dst, void *_src,
+                            ptrdiff_t stride)
+{
+    const int *cnt = (const int *)s->tmp;
+    const int *map = cnt + SR_LEVELS;
+
+    for (int i = 0; i < SR_LEVELS; i++)
+        map += cnt[i];
+
+    ff_tx_fft_sr_permute_float_rvv(_dst, _src, map, s->len);
+    sr_run(s, _dst);
+}
+
+void ff_tx_fft_sr_ns_float_rvv(AVTXContext *s, void *_dst, void *_src,
+                               ptrdiff_t stride)
+{
+    if (_dst != _src)
+        memcpy(_dst, _src, s->len*sizeof(TXComplex));
+
+    sr_run(s, _dst);
+}
+
+static av_cold int mdct_init(AVTXContext *s, const FFTXCodelet *cd,
+                             uint64_t flags, FFTXCodeletOptions *opts,
+                             int len, int inv, const void *scale)
+{
+    int ret;
+    FFTXCodeletOptions sub_opts = {
+        .map_dir = !inv ? FF_TX_MAP_SCATTER : FF_TX_MAP_GATHER,
+    };
+
+    s->scale_d = *((float *)scale);
+    s->scale_f = s->scale_d;
+
+    flags &= ~FF_TX_OUT_OF_PLACE; /* We want the subtransform to be */
+    flags |=  AV_TX_INPLACE;      /* in-place */
+    flags |=  FF_TX_PRESHUFFLE;   /* First try with an in-place transform */
+
+    if ((ret = ff_tx_init_subtx(s, TX_TYPE(FFT), flags, &sub_opts, len >> 1,
+                                inv, scale))) {
+        flags &= ~FF_TX_PRESHUFFLE; /* Now try with a generic FFT */
+        if ((ret = ff_tx_init_subtx(s, TX_TYPE(FFT), flags, &sub_opts, len >> 1,
+                                    inv, scale)))
+            return ret;
+    }
+
+    s->map = av_malloc((len >> 1)*sizeof(*s->map));
+    if (!s->map)
+        return AVERROR(ENOMEM);
+
+    /* If we need to preshuffle copy the map from the subcontext */
+    if (s->sub[0].flags & FF_TX_PRESHUFFLE) {
+        memcpy(s->map, s->sub->map, (len >> 1)*sizeof(*s->map));
+    } else {
+        for (int i = 0; i < len >> 1; i++)
+            s->map[i] = i;
+    }
+
+    if ((ret = ff_tx_mdct_gen_exp_float(s, inv ? s->map : NULL)))
+        return ret;
+
+    if (inv)
+        for (int i = 0; i < (s->len >> 1); i++)
+            s->map[i] <<= 1;
+
+    return 0;
+}
+
+void ff_tx_mdct_fwd_float_rvv(AVTXContext *s, void *_dst, void *_src,
+                              ptrdiff_t stride)
+{
+    TXSample *dst = _dst;
+    TXComplex *exp = s->exp, *z = _dst;
+    const int len2 = s->len >> 1;
+    const int len4 = s->len >> 2;
+
+    ff_tx_mdct_fwd_pre_float_rvv(z, _src, s->map, exp, len2);
+
+    s->fn[0](&s->sub[0], z, z, sizeof(TXComplex));
+
+    if (stride == sizeof(*dst)) {
+        ff_tx_mdct_fwd_post_float_rvv(z, exp, len4);
+        return;
+    }
+
+    /* Strided output overlaps the FFT output, keep the C order. */
+    stride /= sizeof(*dst);
+
+    for (int i = 0; i < len4; i++) {
+        const int i0 = len4 + i, i1 = len4 - i - 1;
+        TXComplex src1 = { z[i1].re, z[i1].im };
+        TXComplex src0 = { z[i0].re, z[i0].im };
+
+        CMUL(dst[2*i1*stride + stride], dst[2*i0*stride], src0.re, src0.im,
+             exp[i0].im, exp[i0].re);
+        CMUL(dst[2*i0*stride + stride], dst[2*i1*stride], src1.re, src1.im,
+             exp[i1].im, exp[i1].re);
+    }
+}
+
+void ff_tx_mdct_inv_float_rvv(AVTXContext *s, void *_dst, void *_src,
+                              ptrdiff_t stride)
+{
+    TXComplex *z = _dst, *exp = s->exp;
+    const int len2 = s->len >> 1;
+
+    ff_tx_mdct_inv_pre_float_rvv(z, _src, s->map, exp, len2, stride);
+
+    s->fn[0](&s->sub[0], z, z, sizeof(TXComplex));
+
+    ff_tx_mdct_inv_post_float_rvv(z, exp + len2, s->len >> 2);
+}
+
+static av_cold int rdft_init(AVTXContext *s, const FFTXCodelet *cd,
+                             uint64_t flags, FFTXCodeletOptions *opts,
+                             int len, int inv, const void *scale)
+{
+    int ret;
+    double f, m;
+    TXSample *tab;
+    int len4 = len / 4;
+
+    s->scale_d = *((float *)scale);
+    s->scale_f = s->scale_d;
+
+    if ((ret = ff_tx_init_subtx(s, TX_TYPE(FFT), flags, NULL, len >> 1, inv, scale)))
+        return ret;
+
+    if (!(s->exp = av_mallocz((8 + 2*len4)*sizeof(*s->exp))))
+        return AVERROR(ENOMEM);
+
+    tab = (TXSample *)s->exp;
+
+    f = 2*M_PI/len;
+
+    m = (inv ? 2*s->scale_d : s->scale_d);
+
+    *tab++ = (inv ? 0.5 : 1.0) * m;
+    *tab++ = inv ? 0.5*m : 1.0*m;
+    *tab++ =  m;
+    *tab++ = -m;
+
+    *tab++ =  (0.5 - 0.0) * m;
+    *tab++ =  (0.0 - 0.5) * m;
+    *tab++ =  (0.5 - inv) * m;
+    *tab++ = -(0.5 - inv) * m;
+
+    for (int i = 0; i < len4; i++)
+        *tab++ = cos(i*f);
+
+    for (int i = 0; i < len4; i++)
+        *tab++ = cos(((len - i*4)/4.0)*f) * (inv ? 1 : -1);
+
+    return 0;
+}
+
+static av_always_inline void rdft_postproc(AVTXContext *s, TXComplex *data)
+{
+    const int len4 = s->len >> 2;
+    const TXSample *fact = (void *)s->exp;
+    TXSample t;
+
+    t = data[0].re;
+    data[0].re = t + data[0].im;
+    data[0].im = t - data[0].im;
+    data[   0].re = fact[0] * data[   0].re;
+    data[   0].im = fact[1] * data[   0].im;
+    data[len4].re = fact[2] * data[len4].re;
+    data[len4].im = fact[3] * data[len4].im;
+
+    ff_tx_rdft_post_float_rvv(data, fact, len4);
+}
+
+void ff_tx_rdft_r2c_float_rvv(AVTXContext *s, void *_dst, void *_src,
+                              ptrdiff_t stride)
+{
+    TXComplex *data = _dst;
+    const int len2 = s->len >> 1;
+
+    s->fn[0](&s->sub[0], data, _src, sizeof(TXComplex));
+
+    rdft_postproc(s, data);
+
+    /* Move [0].im to the last position, as convention requires */
+    data[len2].re = data[0].im;
+    data[   0].im = data[len2].im = 0;
+}
+
+void ff_tx_rdft_c2r_float_rvv(AVTXContext *s, void *_dst, void *_src,
+                              ptrdiff_t stride)
+{
+    TXComplex *data = _src;
+
+    data[0].im = data[s->len >> 1].re;
+
+    rdft_postproc(s, data);
+
+    s->fn[0](&s->sub[0], _dst, data, sizeof(TXComplex));
+}
+
+const FFTXCodelet * const ff_tx_codelet_list_float_riscv[] = {
+    TX_DEF(fft_sr,    FFT,  16,           131072, 2,             0, 128,
+           fft_sr_init,    rvv, RVV_F32, AV_TX_UNALIGNED, 0),
+    TX_DEF(fft_sr_ns, FFT,  16,           131072, 2,             0, 192,
+           fft_sr_ns_init, rvv, RVV_F32,
+           AV_TX_UNALIGNED | AV_TX_INPLACE | FF_TX_PRESHUFFLE, 0),
+
+    TX_DEF(mdct_fwd, MDCT,  32, TX_LEN_UNLIMITED, 2, TX_FACTOR_ANY, 128,
+           mdct_init, rvv, RVV_F32, AV_TX_UNALIGNED | FF_TX_FORWARD_ONLY, 0),
+    TX_DEF(mdct_inv, MDCT,  32, TX_LEN_UNLIMITED, 2, TX_FACTOR_ANY, 128,
+           mdct_init, rvv, RVV_F32, AV_TX_UNALIGNED | FF_TX_INVERSE_ONLY, 0),
+
+    TX_DEF(rdft_r2c, RDFT,  32, TX_LEN_UNLIMITED, 4, TX_FACTOR_ANY, 128,
+           rdft_init, rvv, RVV_F32,
+           AV_TX_UNALIGNED | AV_TX_INPLACE | FF_TX_FORWARD_ONLY, 0),
+    TX_DEF(rdft_c2r, RDFT,  32, TX_LEN_UNLIMITED, 4, TX_FACTOR_ANY, 128,
+           rdft_init, rvv, RVV_F32,
+           AV_TX_UNALIGNED | AV_TX_INPLACE | FF_TX_INVERSE_ONLY, 0),
+
+    NULL,
+};
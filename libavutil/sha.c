@@ -31,6 +31,10 @@
 #include "intreadwrite.h"
 #include "mem.h"
 
+#if ARCH_RISCV
+#include "riscv/sha.h"
+#endif
+
 /** hash context */
 typedef struct AVSHA {
     uint8_t  digest_len;  ///< digest length in 32-bit words
@@ -308,6 +312,9 @@ av_cold int av_sha_init(AVSHA *ctx, int bits)
     default:
         return AVERROR(EINVAL);
     }
+#if ARCH_RISCV
+    ff_sha_init_riscv(&ctx->transform, bits);
+#endif
     ctx->count = 0;
     return 0;
 }
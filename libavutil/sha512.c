@@ -31,12 +31,18 @@
 #include "intreadwrite.h"
 #include "mem.h"
 
+#if ARCH_RISCV
+#include "riscv/sha.h"
+#endif
+
 /** hash context */
 typedef struct AVSHA512 {
     uint8_t  digest_len;  ///< digest length in 64-bit words
     uint64_t count;       ///< number of bytes in buffer
     uint8_t  buffer[128]; ///< 1024-bit buffer of input values used in hash updating
     uint64_t state[8];    ///< current hash value
+    /** function used to update hash for 1024-bit input block */
+    void     (*transform)(uint64_t *state, const uint8_t buffer[128]);
 } AVSHA512;
 
 const int av_sha512_size = sizeof(AVSHA512);
@@ -236,6 +242,10 @@ av_cold int av_sha512_init(AVSHA512 *ctx, int bits)
     default:
         return AVERROR(EINVAL);
     }
+    ctx->transform = sha512_transform;
+#if ARCH_RISCV
+    ff_sha512_init_riscv(&ctx->transform);
+#endif
     ctx->count = 0;
     return 0;
 }
@@ -251,7 +261,7 @@ void av_sha512_update(AVSHA512* ctx, const uint8_t* data, size_t len)
     for (i = 0; i < len; i++) {
         ctx->buffer[j++] = data[i];
         if (128 == j) {
-            sha512_transform(ctx->state, ctx->buffer);
+            ctx->transform(ctx->state, ctx->buffer);
             j = 0;
         }
     }
@@ -259,13 +269,13 @@ void av_sha512_update(AVSHA512* ctx, const uint8_t* data, size_t len)
     if (len >= 128 - j) {
         const uint8_t *end;
         memcpy(&ctx->buffer[j], data, (i = 128 - j));
-        sha512_transform(ctx->state, ctx->buffer);
+        ctx->transform(ctx->state, ctx->buffer);
         data += i;
         len  -= i;
         end   = data + (len & ~127);
         len   = len % 128;
         for (; data < end; data += 128)
-            sha512_transform(ctx->state, data);
+            ctx->transform(ctx->state, data);
         j = 0;
     }
     memcpy(&ctx->buffer[j], data, len);
@@ -114,6 +114,33 @@ int main(int argc, char **argv)
                 }
             }
         }
+
+        /* throughput of CBC on larger buffers */
+        {
+            static uint8_t buf[3][4096];
+            const int blocks = sizeof(buf[0]) / 16;
+
+            for (j = 0; j < sizeof(buf[0]); j++)
+                buf[0][j] = av_lfg_get(&prng);
+            for (i = 0; i < 1000; i++) {
+                memset(iv, 0, sizeof(iv));
+                {
+                    START_TIMER;
+                    av_aes_crypt(ae, buf[1], buf[0], blocks, iv[0], 0);
+                    STOP_TIMER("aes cbc encrypt 4096 bytes");
+                }
+                {
+                    START_TIMER;
+                    av_aes_crypt(ad, buf[2], buf[1], blocks, iv[1], 1);
+                    STOP_TIMER("aes cbc decrypt 4096 bytes");
+                }
+                if (memcmp(buf[0], buf[2], sizeof(buf[0]))) {
+                    av_log(NULL, AV_LOG_ERROR, "CBC round trip mismatch\n");
+                    err = 1;
+                    break;
+                }
+            }
+        }
         av_free(ae);
         av_free(ad);
     }
@@ -90,10 +90,15 @@ static const struct {
     { AV_CPU_FLAG_RVD,       "rvd"        },
     { AV_CPU_FLAG_RVB_ADDR,  "zba"        },
     { AV_CPU_FLAG_RVB_BASIC, "zbb"        },
+    { AV_CPU_FLAG_RVB_CLMUL, "zbc"        },
     { AV_CPU_FLAG_RVV_I32,   "zve32x"     },
     { AV_CPU_FLAG_RVV_F32,   "zve32f"     },
     { AV_CPU_FLAG_RVV_I64,   "zve64x"     },
     { AV_CPU_FLAG_RVV_F64,   "zve64d"     },
+    { AV_CPU_FLAG_RV_ZVBC,   "zvbc"       },
+    { AV_CPU_FLAG_RV_ZVKNED, "zvkned"     },
+    { AV_CPU_FLAG_RV_ZVKNHA, "zvknha"     },
+    { AV_CPU_FLAG_RV_ZVKNHB, "zvknhb"     },
 #endif
     { 0 }
 };
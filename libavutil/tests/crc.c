@@ -18,10 +18,14 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "libavutil/common.h"
 #include "libavutil/crc.h"
+#include "libavutil/timer.h"
 
-int main(void)
+int main(int argc, char **argv)
 {
     uint8_t buf[1999];
     int i;
@@ -43,5 +47,18 @@ int main(void)
         ctx = av_crc_get_table(p[i][0]);
         printf("crc %08X = %X\n", p[i][1], av_crc(ctx, 0, buf, sizeof(buf)));
     }
+
+    /* -t [n]: benchmark the n-th CRC of the list above */
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+        volatile uint32_t crc = 0;
+
+        i = argc > 2 ? av_clip(atoi(argv[2]), 0, 6) : 0;
+        ctx = av_crc_get_table(p[i][0]);
+        for (int j = 0; j < 10000; j++) {
+            START_TIMER;
+            crc = av_crc(ctx, crc, buf, sizeof(buf));
+            STOP_TIMER("crc");
+        }
+    }
     return 0;
 }
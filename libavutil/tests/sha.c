@@ -17,11 +17,13 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "libavutil/mem.h"
 #include "libavutil/sha.h"
+#include "libavutil/timer.h"
 
-int main(void)
+int main(int argc, char **argv)
 {
     int i, j, k;
     struct AVSHA *ctx;
@@ -69,6 +71,18 @@ int main(void)
             break;
         }
     }
+
+    /* -t: benchmark SHA-256 on 4096-byte updates */
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+        static const uint8_t buf[4096];
+
+        av_sha_init(ctx, 256);
+        for (i = 0; i < 10000; i++) {
+            START_TIMER;
+            av_sha_update(ctx, buf, sizeof(buf));
+            STOP_TIMER("sha256");
+        }
+    }
     av_free(ctx);
 
     return 0;
@@ -22,11 +22,13 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "libavutil/mem.h"
 #include "libavutil/sha512.h"
+#include "libavutil/timer.h"
 
-int main(void)
+int main(int argc, char **argv)
 {
     int i, j, k;
     struct AVSHA512 *ctx;
@@ -84,6 +86,18 @@ int main(void)
             break;
         }
     }
+
+    /* -t: benchmark SHA-512 on 4096-byte updates */
+    if (argc > 1 && !strcmp(argv[1], "-t")) {
+        static const uint8_t buf[4096];
+
+        av_sha512_init(ctx, 512);
+        for (i = 0; i < 10000; i++) {
+            START_TIMER;
+            av_sha512_update(ctx, buf, sizeof(buf));
+            STOP_TIMER("sha512");
+        }
+    }
     av_free(ctx);
 
     return 0;
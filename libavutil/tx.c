@@ -347,6 +347,9 @@ static const FFTXCodelet * const * const codelet_list[] = {
 #if ARCH_AARCH64
     ff_tx_codelet_list_float_aarch64,
 #endif
+#if ARCH_RISCV && HAVE_RVV
+    ff_tx_codelet_list_float_riscv,
+#endif
 };
 static const int codelet_list_num = FF_ARRAY_ELEMS(codelet_list);
 
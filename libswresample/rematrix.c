@@ -547,6 +547,8 @@ av_cold int swri_rematrix_init(SwrContext *s){
 
 #if ARCH_X86 && HAVE_X86ASM && HAVE_MMX
     return swri_rematrix_init_x86(s);
+#elif ARCH_RISCV
+    return swri_rematrix_init_riscv(s);
 #endif
 
     return 0;
@@ -64,5 +64,6 @@ void swri_resample_dsp_init(ResampleContext *c);
 void swri_resample_dsp_x86_init(ResampleContext *c);
 void swri_resample_dsp_arm_init(ResampleContext *c);
 void swri_resample_dsp_aarch64_init(ResampleContext *c);
+void swri_resample_dsp_riscv_init(ResampleContext *c);
 
 #endif /* SWRESAMPLE_RESAMPLE_H */
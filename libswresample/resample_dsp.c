@@ -74,5 +74,7 @@ void swri_resample_dsp_init(ResampleContext *c)
     swri_resample_dsp_arm_init(c);
 #elif ARCH_AARCH64
     swri_resample_dsp_aarch64_init(c);
+#elif ARCH_RISCV
+    swri_resample_dsp_riscv_init(c);
 #endif
 }
@@ -0,0 +1,94 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/samplefmt.h"
+#include "libswresample/swresample_internal.h"
+#include "libswresample/audioconvert.h"
+
+#define PROTO(name) \
+void ff_##name##_rvv(uint8_t **dst, const uint8_t **src, int len);
+
+PROTO(int16_to_int32)
+PROTO(int32_to_int16)
+PROTO(int16_to_float)
+PROTO(int32_to_float)
+PROTO(float_to_int16)
+PROTO(float_to_int32)
+PROTO(pack_2ch_int16_to_int16)
+PROTO(pack_2ch_int32_to_int32)
+PROTO(unpack_2ch_int16_to_int16)
+PROTO(unpack_2ch_int32_to_int32)
+PROTO(pack_2ch_float_to_int16)
+
+av_cold void swri_audio_convert_init_riscv(struct AudioConvert *ac,
+                                           enum AVSampleFormat out_fmt,
+                                           enum AVSampleFormat in_fmt,
+                                           int channels)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+#define FMT_PAIR(out, in) \
+    ((out_fmt == AV_SAMPLE_FMT_##out  && in_fmt == AV_SAMPLE_FMT_##in) || \
+     (out_fmt == AV_SAMPLE_FMT_##out##P && in_fmt == AV_SAMPLE_FMT_##in##P))
+
+    if (!(flags & AV_CPU_FLAG_RVB_ADDR))
+        return;
+
+    if (flags & AV_CPU_FLAG_RVV_I32) {
+        if (FMT_PAIR(S32, S16))
+            ac->simd_f = ff_int16_to_int32_rvv;
+        if (FMT_PAIR(S16, S32))
+            ac->simd_f = ff_int32_to_int16_rvv;
+
+        if (channels == 2) {
+            if (out_fmt == AV_SAMPLE_FMT_S16 && in_fmt == AV_SAMPLE_FMT_S16P)
+                ac->simd_f = ff_pack_2ch_int16_to_int16_rvv;
+            if ((out_fmt == AV_SAMPLE_FMT_S32 && in_fmt == AV_SAMPLE_FMT_S32P) ||
+                (out_fmt == AV_SAMPLE_FMT_FLT && in_fmt == AV_SAMPLE_FMT_FLTP))
+                ac->simd_f = ff_pack_2ch_int32_to_int32_rvv;
+            if (out_fmt == AV_SAMPLE_FMT_S16P && in_fmt == AV_SAMPLE_FMT_S16)
+                ac->simd_f = ff_unpack_2ch_int16_to_int16_rvv;
+            if ((out_fmt == AV_SAMPLE_FMT_S32P && in_fmt == AV_SAMPLE_FMT_S32) ||
+                (out_fmt == AV_SAMPLE_FMT_FLTP && in_fmt == AV_SAMPLE_FMT_FLT))
+                ac->simd_f = ff_unpack_2ch_int32_to_int32_rvv;
+        }
+    }
+
+    if (flags & AV_CPU_FLAG_RVV_F32) {
+        if (FMT_PAIR(FLT, S16))
+            ac->simd_f = ff_int16_to_float_rvv;
+        if (FMT_PAIR(FLT, S32))
+            ac->simd_f = ff_int32_to_float_rvv;
+        if (FMT_PAIR(S16, FLT))
+            ac->simd_f = ff_float_to_int16_rvv;
+        if (FMT_PAIR(S32, FLT))
+            ac->simd_f = ff_float_to_int32_rvv;
+
+        if (channels == 2 &&
+            out_fmt == AV_SAMPLE_FMT_S16 && in_fmt == AV_SAMPLE_FMT_FLTP)
+            ac->simd_f = ff_pack_2ch_float_to_int16_rvv;
+    }
+#undef FMT_PAIR
+#endif
+}
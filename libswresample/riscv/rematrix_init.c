@@ -0,0 +1,113 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/common.h"
+#include "libavutil/cpu.h"
+#include "libavutil/error.h"
+#include "libavutil/mem.h"
+#include "libswresample/swresample_internal.h"
+
+#define D(type) \
+mix_1_1_func_type ff_mix_1_1_##type##_rvv; \
+mix_2_1_func_type ff_mix_2_1_##type##_rvv;
+
+D(float)
+D(double)
+D(int16)
+D(clip_int16)
+D(int32)
+
+av_cold int swri_rematrix_init_riscv(struct SwrContext *s)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+    int nb_in  = s->used_ch_layout.nb_channels;
+    int nb_out = s->out.ch_count;
+    int num    = nb_in * nb_out;
+    size_t size;
+
+    s->mix_1_1_simd = NULL;
+    s->mix_2_1_simd = NULL;
+
+    if (!(flags & AV_CPU_FLAG_RVB_ADDR))
+        return 0;
+
+    switch (s->midbuf.fmt) {
+    case AV_SAMPLE_FMT_S16P:
+        if (flags & AV_CPU_FLAG_RVV_I32) {
+            int maxsum = 0;
+
+            /* Same test as the C code, to clip exactly when it does. */
+            for (int i = 0; i < nb_out; i++) {
+                int sum = 0;
+
+                for (int j = 0; j < nb_in; j++)
+                    sum += FFABS(((int *)s->native_matrix)[i * nb_in + j]);
+                maxsum = FFMAX(maxsum, sum);
+            }
+
+            if (maxsum <= 32768) {
+                s->mix_1_1_simd = ff_mix_1_1_int16_rvv;
+                s->mix_2_1_simd = ff_mix_2_1_int16_rvv;
+            } else {
+                s->mix_1_1_simd = ff_mix_1_1_clip_int16_rvv;
+                s->mix_2_1_simd = ff_mix_2_1_clip_int16_rvv;
+            }
+        }
+        size = sizeof(int);
+        break;
+    case AV_SAMPLE_FMT_S32P:
+        if (flags & AV_CPU_FLAG_RVV_I64) {
+            s->mix_1_1_simd = ff_mix_1_1_int32_rvv;
+            s->mix_2_1_simd = ff_mix_2_1_int32_rvv;
+        }
+        size = sizeof(int);
+        break;
+    case AV_SAMPLE_FMT_FLTP:
+        if (flags & AV_CPU_FLAG_RVV_F32) {
+            s->mix_1_1_simd = ff_mix_1_1_float_rvv;
+            s->mix_2_1_simd = ff_mix_2_1_float_rvv;
+        }
+        size = sizeof(float);
+        break;
+    case AV_SAMPLE_FMT_DBLP:
+        if (flags & AV_CPU_FLAG_RVV_F64) {
+            s->mix_1_1_simd = ff_mix_1_1_double_rvv;
+            s->mix_2_1_simd = ff_mix_2_1_double_rvv;
+        }
+        size = sizeof(double);
+        break;
+    default:
+        return 0;
+    }
+
+    if (s->mix_1_1_simd) {
+        /* The vector functions use the same coefficients as the C ones. */
+        s->native_simd_matrix = av_memdup(s->native_matrix, num * size);
+        s->native_simd_one    = av_memdup(s->native_one, size);
+        if (!s->native_simd_matrix || !s->native_simd_one)
+            return AVERROR(ENOMEM);
+    }
+#endif
+
+    return 0;
+}
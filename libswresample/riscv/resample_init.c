@@ -0,0 +1,141 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/common.h"
+#include "libavutil/cpu.h"
+#include "libswresample/resample.h"
+
+void ff_resample_one_int16_rvv(void *dst, const void *src, int n,
+                               int64_t index, int64_t incr);
+void ff_resample_one_int32_rvv(void *dst, const void *src, int n,
+                               int64_t index, int64_t incr);
+void ff_resample_one_int64_rvv(void *dst, const void *src, int n,
+                               int64_t index, int64_t incr);
+
+#define RESAMPLE_COMMON(TYPE, DELEM, FELEM, FELEM2, OUT)                      \
+FELEM2 ff_resample_common_apply_filter_##TYPE##_rvv(const DELEM *src,         \
+                                                    const FELEM *filter,      \
+                                                    int length);              \
+                                                                              \
+static int resample_common_##TYPE##_rvv(ResampleContext *c, void *dest,       \
+                                        const void *source, int n,            \
+                                        int update_ctx)                       \
+{                                                                             \
+    DELEM *dst = dest;                                                        \
+    const DELEM *src = source;                                                \
+    int index = c->index;                                                     \
+    int frac = c->frac;                                                       \
+    int sample_index = 0;                                                     \
+                                                                              \
+    while (index >= c->phase_count) {                                         \
+        sample_index++;                                                       \
+        index -= c->phase_count;                                              \
+    }                                                                         \
+                                                                              \
+    for (int dst_index = 0; dst_index < n; dst_index++) {                     \
+        const FELEM *filter = (const FELEM *)c->filter_bank +                 \
+                              c->filter_alloc * index;                        \
+        FELEM2 val = ff_resample_common_apply_filter_##TYPE##_rvv(            \
+                         &src[sample_index], filter, c->filter_length);       \
+                                                                              \
+        OUT(dst[dst_index], val);                                             \
+                                                                              \
+        frac  += c->dst_incr_mod;                                             \
+        index += c->dst_incr_div;                                             \
+        if (frac >= c->src_incr) {                                            \
+            frac -= c->src_incr;                                              \
+            index++;                                                          \
+        }                                                                     \
+                                                                              \
+        while (index >= c->phase_count) {                                     \
+            sample_index++;                                                   \
+            index -= c->phase_count;                                          \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    if (update_ctx) {                                                         \
+        c->frac = frac;                                                       \
+        c->index = index;                                                     \
+    }                                                                         \
+                                                                              \
+    return sample_index;                                                      \
+}
+
+#define OUT(d, v) (d) = av_clip_int16((v) >> 15)
+RESAMPLE_COMMON(int16, int16_t, int16_t, int64_t, OUT)
+#undef OUT
+
+#if (__riscv_xlen == 64)
+#define OUT(d, v) (d) = av_clipl_int32(((v) + (1 << 29)) >> 30)
+RESAMPLE_COMMON(int32, int32_t, int32_t, int64_t, OUT)
+#undef OUT
+#endif
+
+#define OUT(d, v) (d) = (v)
+RESAMPLE_COMMON(float, float, float, float, OUT)
+RESAMPLE_COMMON(double, double, double, double, OUT)
+#undef OUT
+
+av_cold void swri_resample_dsp_riscv_init(ResampleContext *c)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if (!(flags & AV_CPU_FLAG_RVB_ADDR))
+        return;
+
+    switch (c->format) {
+    case AV_SAMPLE_FMT_S16P:
+        if (flags & AV_CPU_FLAG_RVV_I32)
+            c->dsp.resample_common = resample_common_int16_rvv;
+#if (__riscv_xlen == 64)
+        if (flags & AV_CPU_FLAG_RVV_I64)
+            c->dsp.resample_one = ff_resample_one_int16_rvv;
+#endif
+        break;
+    case AV_SAMPLE_FMT_S32P:
+#if (__riscv_xlen == 64)
+        if (flags & AV_CPU_FLAG_RVV_I64) {
+            c->dsp.resample_common = resample_common_int32_rvv;
+            c->dsp.resample_one = ff_resample_one_int32_rvv;
+        }
+#endif
+        break;
+    case AV_SAMPLE_FMT_FLTP:
+        if (flags & AV_CPU_FLAG_RVV_F32)
+            c->dsp.resample_common = resample_common_float_rvv;
+#if (__riscv_xlen == 64)
+        if (flags & AV_CPU_FLAG_RVV_I64)
+            c->dsp.resample_one = ff_resample_one_int32_rvv;
+#endif
+        break;
+    case AV_SAMPLE_FMT_DBLP:
+        if (flags & AV_CPU_FLAG_RVV_F64)
+            c->dsp.resample_common = resample_common_double_rvv;
+#if (__riscv_xlen == 64)
+        if (flags & AV_CPU_FLAG_RVV_I64)
+            c->dsp.resample_one = ff_resample_one_int64_rvv;
+#endif
+        break;
+    }
+#endif
+}
@@ -0,0 +1,197 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libswscale/swscale_internal.h"
+
+void ff_hscale8to15_rvv(SwsContext *c, int16_t *dst, int dstW,
+                        const uint8_t *src, const int16_t *filter,
+                        const int32_t *filterPos, int filterSize);
+void ff_hscale8to19_rvv(SwsContext *c, int16_t *dst, int dstW,
+                        const uint8_t *src, const int16_t *filter,
+                        const int32_t *filterPos, int filterSize);
+void ff_yuv2planeX_8_rvv(const int16_t *filter, int filterSize,
+                         const int16_t **src, uint8_t *dest, int dstW,
+                         const uint8_t *dither, int offset);
+void ff_yuv2plane1_8_rvv(const int16_t *src, uint8_t *dest, int dstW,
+                         const uint8_t *dither, int offset);
+
+#define P01X_FUNCS(bits) \
+void ff_yuv2p0##bits##l1_LE_rvv(const int16_t *src, uint8_t *dest, int dstW, \
+                                const uint8_t *dither, int offset); \
+void ff_yuv2p0##bits##lX_LE_rvv(const int16_t *filter, int filterSize, \
+                                const int16_t **src, uint8_t *dest, int dstW, \
+                                const uint8_t *dither, int offset); \
+void ff_yuv2p0##bits##cX_LE_rvv(enum AVPixelFormat dstFormat, \
+                                const uint8_t *chrDither, \
+                                const int16_t *chrFilter, int chrFilterSize, \
+                                const int16_t **chrUSrc, \
+                                const int16_t **chrVSrc, \
+                                uint8_t *dest, int chrDstW);
+
+P01X_FUNCS(10)
+P01X_FUNCS(12)
+
+#define RGB_FUNCS(name) \
+void ff_##name##ToY_rvv(uint8_t *dst, const uint8_t *src, const uint8_t *, \
+                        const uint8_t *, int width, uint32_t *coeffs, \
+                        void *); \
+void ff_##name##ToUV_rvv(uint8_t *dstU, uint8_t *dstV, const uint8_t *, \
+                         const uint8_t *src1, const uint8_t *src2, \
+                         int width, uint32_t *coeffs, void *); \
+void ff_##name##ToUV_half_rvv(uint8_t *dstU, uint8_t *dstV, \
+                              const uint8_t *, const uint8_t *src1, \
+                              const uint8_t *src2, int width, \
+                              uint32_t *coeffs, void *);
+
+RGB_FUNCS(rgb24)
+RGB_FUNCS(bgr24)
+RGB_FUNCS(rgba32)
+RGB_FUNCS(bgra32)
+RGB_FUNCS(argb32)
+RGB_FUNCS(abgr32)
+
+void ff_nv12ToUV_rvv(uint8_t *dstU, uint8_t *dstV, const uint8_t *,
+                     const uint8_t *src1, const uint8_t *src2, int width,
+                     uint32_t *, void *);
+void ff_nv21ToUV_rvv(uint8_t *dstU, uint8_t *dstV, const uint8_t *,
+                     const uint8_t *src1, const uint8_t *src2, int width,
+                     uint32_t *, void *);
+void ff_p010LEToY_rvv(uint8_t *dst, const uint8_t *src, const uint8_t *,
+                      const uint8_t *, int width, uint32_t *, void *);
+void ff_p010LEToUV_rvv(uint8_t *dstU, uint8_t *dstV, const uint8_t *,
+                       const uint8_t *src1, const uint8_t *src2, int width,
+                       uint32_t *, void *);
+void ff_y210LEToY_rvv(uint8_t *dst, const uint8_t *src, const uint8_t *,
+                      const uint8_t *, int width, uint32_t *, void *);
+void ff_y210LEToUV_rvv(uint8_t *dstU, uint8_t *dstV, const uint8_t *,
+                       const uint8_t *src1, const uint8_t *src2, int width,
+                       uint32_t *, void *);
+void ff_y212LEToY_rvv(uint8_t *dst, const uint8_t *src, const uint8_t *,
+                      const uint8_t *, int width, uint32_t *, void *);
+void ff_y212LEToUV_rvv(uint8_t *dstU, uint8_t *dstV, const uint8_t *,
+                       const uint8_t *src1, const uint8_t *src2, int width,
+                       uint32_t *, void *);
+
+static av_cold void sws_init_input_riscv(SwsContext *c)
+{
+#define init_rgb(name) \
+    c->lumToYV12 = ff_##name##ToY_rvv; \
+    c->chrToYV12 = c->chrSrcHSubSample ? ff_##name##ToUV_half_rvv \
+                                       : ff_##name##ToUV_rvv
+
+    switch (c->srcFormat) {
+    case AV_PIX_FMT_RGB24:
+        init_rgb(rgb24);
+        break;
+    case AV_PIX_FMT_BGR24:
+        init_rgb(bgr24);
+        break;
+    case AV_PIX_FMT_RGBA:
+        init_rgb(rgba32);
+        break;
+    case AV_PIX_FMT_BGRA:
+        init_rgb(bgra32);
+        break;
+    case AV_PIX_FMT_ARGB:
+        init_rgb(argb32);
+        break;
+    case AV_PIX_FMT_ABGR:
+        init_rgb(abgr32);
+        break;
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_NV16:
+    case AV_PIX_FMT_NV24:
+        c->chrToYV12 = ff_nv12ToUV_rvv;
+        break;
+    case AV_PIX_FMT_NV21:
+    case AV_PIX_FMT_NV42:
+        c->chrToYV12 = ff_nv21ToUV_rvv;
+        break;
+    case AV_PIX_FMT_P010LE:
+    case AV_PIX_FMT_P210LE:
+    case AV_PIX_FMT_P410LE:
+        c->lumToYV12 = ff_p010LEToY_rvv;
+        c->chrToYV12 = ff_p010LEToUV_rvv;
+        break;
+    case AV_PIX_FMT_Y210LE:
+        c->lumToYV12 = ff_y210LEToY_rvv;
+        c->chrToYV12 = ff_y210LEToUV_rvv;
+        break;
+    case AV_PIX_FMT_Y212LE:
+        c->lumToYV12 = ff_y212LEToY_rvv;
+        c->chrToYV12 = ff_y212LEToUV_rvv;
+        break;
+    default:
+        break;
+    }
+
+#undef init_rgb
+}
+
+static av_cold void sws_init_output_p01x_riscv(SwsContext *c)
+{
+    if (!isSemiPlanarYUV(c->dstFormat) || !isDataInHighBits(c->dstFormat) ||
+        isBE(c->dstFormat))
+        return;
+
+    switch (c->dstBpc) {
+    case 10:
+        c->yuv2plane1 = ff_yuv2p010l1_LE_rvv;
+#if (__riscv_xlen == 64)
+        c->yuv2planeX = ff_yuv2p010lX_LE_rvv;
+        c->yuv2nv12cX = ff_yuv2p010cX_LE_rvv;
+#endif
+        break;
+    case 12:
+        c->yuv2plane1 = ff_yuv2p012l1_LE_rvv;
+#if (__riscv_xlen == 64)
+        c->yuv2planeX = ff_yuv2p012lX_LE_rvv;
+        c->yuv2nv12cX = ff_yuv2p012cX_LE_rvv;
+#endif
+        break;
+    }
+}
+
+av_cold void ff_sws_init_swscale_riscv(SwsContext *c)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        if (c->srcBpc == 8) {
+            if (c->dstBpc <= 14)
+                c->hyScale = c->hcScale = ff_hscale8to15_rvv;
+            else
+                c->hyScale = c->hcScale = ff_hscale8to19_rvv;
+        }
+        if (c->dstBpc == 8) {
+            c->yuv2plane1 = ff_yuv2plane1_8_rvv;
+#if (__riscv_xlen == 64)
+            c->yuv2planeX = ff_yuv2planeX_8_rvv;
+#endif
+        }
+        sws_init_output_p01x_riscv(c);
+        sws_init_input_riscv(c);
+    }
+#endif
+}
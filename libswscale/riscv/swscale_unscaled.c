@@ -0,0 +1,101 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libavutil/pixdesc.h"
+#include "libswscale/swscale_internal.h"
+
+void ff_planar_copy_up_8_rvv(uint16_t *dst, const uint8_t *src, int width,
+                             int shl, int shr, int mask);
+void ff_planar_copy_up_16_rvv(uint16_t *dst, const uint16_t *src, int width,
+                              int shl, int shr, int mask);
+
+/*
+ * Bit-depth increase between little-endian planar YUV formats, with the same
+ * output as planarCopyWrapper(): the low bits are replicated from the high
+ * ones, except for the chroma planes and limited range luma.
+ */
+static int planar_copy_up_rvv(SwsContext *c, const uint8_t *src[],
+                              int srcStride[], int srcSliceY, int srcSliceH,
+                              uint8_t *dst[], int dstStride[])
+{
+    const AVPixFmtDescriptor *desc_src = av_pix_fmt_desc_get(c->srcFormat);
+    const AVPixFmtDescriptor *desc_dst = av_pix_fmt_desc_get(c->dstFormat);
+
+    for (int plane = 0; plane < 4 && dst[plane] != NULL; plane++) {
+        int luma = plane == 0 || plane == 3;
+        int length = luma ? c->srcW : AV_CEIL_RSHIFT(c->srcW, c->chrDstHSubSample);
+        int y = luma ? srcSliceY : AV_CEIL_RSHIFT(srcSliceY, c->chrDstVSubSample);
+        int height = luma ? srcSliceH : AV_CEIL_RSHIFT(srcSliceH, c->chrDstVSubSample);
+        int shiftonly = plane == 1 || plane == 2 || (!c->srcRange && plane == 0);
+        int src_depth = desc_src->comp[plane].depth;
+        int dst_depth = desc_dst->comp[plane].depth;
+        int shl = dst_depth - src_depth;
+        int shr = 2 * src_depth - dst_depth;
+        int mask = shiftonly ? 0 : 0xffff;
+        const uint8_t *srcPtr = src[plane];
+        uint8_t *dstPtr = dst[plane] + dstStride[plane] * y;
+
+        for (int i = 0; i < height; i++) {
+            if (src_depth == 8)
+                ff_planar_copy_up_8_rvv((uint16_t *)dstPtr, srcPtr, length,
+                                        shl, shr, mask);
+            else
+                ff_planar_copy_up_16_rvv((uint16_t *)dstPtr,
+                                         (const uint16_t *)srcPtr, length,
+                                         shl, shr, mask);
+            srcPtr += srcStride[plane];
+            dstPtr += dstStride[plane];
+        }
+    }
+    return srcSliceH;
+}
+
+static int is_planar_copy_up(SwsContext *c)
+{
+    enum AVPixelFormat srcFormat = c->srcFormat;
+    enum AVPixelFormat dstFormat = c->dstFormat;
+    const AVPixFmtDescriptor *desc_src = av_pix_fmt_desc_get(srcFormat);
+    const AVPixFmtDescriptor *desc_dst = av_pix_fmt_desc_get(dstFormat);
+
+    return isPlanarYUV(srcFormat) && isPlanarYUV(dstFormat) &&
+           !isSemiPlanarYUV(srcFormat) && !isSemiPlanarYUV(dstFormat) &&
+           !isFloat(srcFormat) && !isFloat(dstFormat) &&
+           !isBE(srcFormat) && !isBE(dstFormat) &&
+           isALPHA(srcFormat) == isALPHA(dstFormat) &&
+           c->chrDstHSubSample == c->chrSrcHSubSample &&
+           c->chrDstVSubSample == c->chrSrcVSubSample &&
+           desc_src->comp[0].depth < desc_dst->comp[0].depth &&
+           desc_dst->comp[0].depth <= 16;
+}
+
+av_cold void ff_get_unscaled_swscale_riscv(SwsContext *c)
+{
+#if HAVE_RVV
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I32) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        if (c->convert_unscaled && is_planar_copy_up(c))
+            c->convert_unscaled = planar_copy_up_rvv;
+    }
+#endif
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with FFmpeg; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdint.h>
+
+#include "config.h"
+#include "libavutil/attributes.h"
+#include "libavutil/cpu.h"
+#include "libswscale/swscale_internal.h"
+
+#define YUV2RGB_ROW(name) \
+void ff_yuv2##name##_row_rvv(uint8_t *dst, const uint8_t *y, \
+                             const uint8_t *u, const uint8_t *v, int width, \
+                             const void *const tabs[4]);
+
+YUV2RGB_ROW(rgb32)
+YUV2RGB_ROW(rgb24)
+YUV2RGB_ROW(bgr24)
+
+/* Same row pairing and chroma addressing as the C converters. */
+#define YUV2RGB_FUNC(name)                                                   \
+static int yuv2##name##_rvv(SwsContext *c, const uint8_t *src[],             \
+                            int srcStride[], int srcSliceY, int srcSliceH,   \
+                            uint8_t *dst[], int dstStride[])                 \
+{                                                                            \
+    const void *const tabs[4] = {                                            \
+        c->table_rV + YUVRGB_TABLE_HEADROOM,                                 \
+        c->table_gU + YUVRGB_TABLE_HEADROOM,                                 \
+        c->table_gV + YUVRGB_TABLE_HEADROOM,                                 \
+        c->table_bU + YUVRGB_TABLE_HEADROOM,                                 \
+    };                                                                       \
+    int chroma_step = c->srcFormat == AV_PIX_FMT_YUV422P ? 2 : 1;            \
+                                                                             \
+    for (int y = 0; y < srcSliceH; y += 2) {                                 \
+        uint8_t *dst_1 = dst[0] + (y + srcSliceY) * dstStride[0];            \
+        const uint8_t *py_1 = src[0] + y * srcStride[0];                     \
+        const uint8_t *pu = src[1] + (y >> 1) * chroma_step * srcStride[1];  \
+        const uint8_t *pv = src[2] + (y >> 1) * chroma_step * srcStride[2];  \
+                                                                             \
+        ff_yuv2##name##_row_rvv(dst_1, py_1, pu, pv, c->dstW, tabs);         \
+        ff_yuv2##name##_row_rvv(dst_1 + dstStride[0], py_1 + srcStride[0],   \
+                                pu, pv, c->dstW, tabs);                      \
+    }                                                                        \
+    return srcSliceH;                                                        \
+}
+
+YUV2RGB_FUNC(rgb32)
+YUV2RGB_FUNC(rgb24)
+YUV2RGB_FUNC(bgr24)
+
+av_cold SwsFunc ff_yuv2rgb_init_riscv(SwsContext *c)
+{
+#if HAVE_RVV && (__riscv_xlen == 64)
+    int flags = av_get_cpu_flags();
+
+    if ((flags & AV_CPU_FLAG_RVV_I64) && (flags & AV_CPU_FLAG_RVB_ADDR)) {
+        switch (c->dstFormat) {
+        case AV_PIX_FMT_ARGB:
+        case AV_PIX_FMT_ABGR:
+        case AV_PIX_FMT_RGBA:
+        case AV_PIX_FMT_BGRA:
+            if (!CONFIG_SWSCALE_ALPHA || !isALPHA(c->srcFormat))
+                return yuv2rgb32_rvv;
+            break;
+        case AV_PIX_FMT_RGB24:
+            return yuv2rgb24_rvv;
+        case AV_PIX_FMT_BGR24:
+            return yuv2bgr24_rvv;
+        default:
+            break;
+        }
+    }
+#endif
+    return NULL;
+}
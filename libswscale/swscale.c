@@ -601,6 +601,8 @@ void ff_sws_init_scale(SwsContext *c)
     ff_sws_init_swscale_arm(c);
 #elif ARCH_LOONGARCH64
     ff_sws_init_swscale_loongarch(c);
+#elif ARCH_RISCV
+    ff_sws_init_swscale_riscv(c);
 #endif
 }
 
@@ -2232,6 +2232,8 @@ void ff_get_unscaled_swscale(SwsContext *c)
     ff_get_unscaled_swscale_arm(c);
 #elif ARCH_AARCH64
     ff_get_unscaled_swscale_aarch64(c);
+#elif ARCH_RISCV
+    ff_get_unscaled_swscale_riscv(c);
 #endif
 }
 
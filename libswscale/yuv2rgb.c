@@ -685,6 +685,8 @@ SwsFunc ff_yuv2rgb_get_func_ptr(SwsContext *c)
     t = ff_yuv2rgb_init_x86(c);
 #elif ARCH_LOONGARCH64
     t = ff_yuv2rgb_init_loongarch(c);
+#elif ARCH_RISCV
+    t = ff_yuv2rgb_init_riscv(c);
 #endif
 
     if (t)
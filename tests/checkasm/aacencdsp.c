@@ -23,6 +23,8 @@
 #include "libavutil/mem_internal.h"
 
 #include "libavcodec/aacencdsp.h"
+#include "libavcodec/aacenc_utils.h"
+#include "libavcodec/aactab.h"
 
 #include "checkasm.h"
 
@@ -60,6 +62,136 @@ static void test_abs_pow34(AACEncDSPContext *s)
     report("abs_pow34");
 }
 
+static void test_quant_bands(AACEncDSPContext *s)
+{
+    static const int maxvals[] = { 1, 2, 4, 7, 12, 16, 8191 };
+    int maxval = maxvals[rnd() % FF_ARRAY_ELEMS(maxvals)];
+    float q34 = (float)rnd() / (UINT_MAX / 2) + 0.25f;
+    float rounding = (rnd() & 1) ? ROUND_TO_ZERO : ROUND_STANDARD;
+    LOCAL_ALIGNED_32(float, in, [BUF_SIZE]);
+    LOCAL_ALIGNED_32(float, scaled, [BUF_SIZE]);
+
+    declare_func(void, int *, const float *, const float *, int, int, int,
+                 const float, const float);
+
+    randomize_float(in, BUF_SIZE);
+    abs_pow34_v(scaled, in, BUF_SIZE);
+
+    for (int sign = 0; sign <= 1; sign++) {
+        if (check_func(s->quant_bands, "quant_bands_%s",
+                       sign ? "signed" : "unsigned")) {
+            LOCAL_ALIGNED_32(int, out, [BUF_SIZE]);
+            LOCAL_ALIGNED_32(int, out2, [BUF_SIZE]);
+
+            for (int size = 4; size <= BUF_SIZE; size *= 4) {
+                call_ref(out, in, scaled, size, sign, maxval, q34, rounding);
+                call_new(out2, in, scaled, size, sign, maxval, q34, rounding);
+
+                if (memcmp(out, out2, size * sizeof(*out)))
+                    fail();
+            }
+
+            bench_new(out, in, scaled, BUF_SIZE, sign, maxval, q34, rounding);
+        }
+    }
+
+    report("quant_bands");
+}
+
+static void test_quant_cost(AACEncDSPContext *s)
+{
+    /* codebooks without escape values, indexed by codebook - 1 */
+    static const uint8_t ranges[10]  = { 3, 3, 3, 3, 9, 9, 8, 8, 13, 13 };
+    static const uint8_t maxvals[10] = { 1, 1, 2, 2, 4, 4, 7, 7, 12, 12 };
+#define MAX_BAND 96
+    LOCAL_ALIGNED_32(float, in, [MAX_BAND]);
+    LOCAL_ALIGNED_32(int, quant, [MAX_BAND]);
+    LOCAL_ALIGNED_16(float, rd, [MAX_BAND / 2]);
+    LOCAL_ALIGNED_16(float, rd2, [MAX_BAND / 2]);
+    LOCAL_ALIGNED_16(int, bits, [MAX_BAND / 2]);
+    LOCAL_ALIGNED_16(int, bits2, [MAX_BAND / 2]);
+    float iq = (float)rnd() / (UINT_MAX / 4) + 0.25f;
+
+    declare_func(float, float *, int *, const float *, const int *, int, int,
+                 const uint8_t *, const float *, const float);
+
+    randomize_float(in, MAX_BAND);
+
+    for (int is_unsigned = 0; is_unsigned <= 1; is_unsigned++) {
+        for (int pair = 0; pair <= 1; pair++) {
+            /* signed quads use codebooks 1-2, signed pairs 5-6,
+             * unsigned quads 3-4 and unsigned pairs 7-10 */
+            int cb = 2 * is_unsigned + 4 * pair + (pair && is_unsigned ?
+                                                   rnd() % 4 : rnd() % 2);
+            int dim = pair ? 2 : 4;
+
+            if (check_func(s->quant_cost[is_unsigned][pair], "quant_cost_%s%s",
+                           is_unsigned ? "u" : "s", pair ? "pair" : "quad")) {
+                float e, e2;
+
+                for (int i = 0; i < MAX_BAND; i++) {
+                    int q = rnd() % (maxvals[cb] + 1);
+                    if (is_unsigned) {
+                        quant[i] = q;
+                    } else {
+                        quant[i] = (rnd() & 1) ? -q : q;
+                    }
+                }
+
+                for (int size = 4; size <= MAX_BAND; size += 12) {
+                    memset(rd,    0, sizeof(*rd)    * MAX_BAND / 2);
+                    memset(rd2,   0, sizeof(*rd2)   * MAX_BAND / 2);
+                    memset(bits,  0, sizeof(*bits)  * MAX_BAND / 2);
+                    memset(bits2, 0, sizeof(*bits2) * MAX_BAND / 2);
+
+                    e  = call_ref(rd, bits, in, quant, size, ranges[cb],
+                                  ff_aac_spectral_bits[cb],
+                                  ff_aac_codebook_vectors[cb], iq);
+                    e2 = call_new(rd2, bits2, in, quant, size, ranges[cb],
+                                  ff_aac_spectral_bits[cb],
+                                  ff_aac_codebook_vectors[cb], iq);
+
+                    if (e != e2 ||
+                        memcmp(rd, rd2, sizeof(*rd) * size / dim) ||
+                        memcmp(bits, bits2, sizeof(*bits) * size / dim))
+                        fail();
+                }
+
+                bench_new(rd2, bits2, in, quant, MAX_BAND, ranges[cb],
+                          ff_aac_spectral_bits[cb],
+                          ff_aac_codebook_vectors[cb], iq);
+            }
+        }
+    }
+
+    report("quant_cost");
+}
+
+static void test_band_energy(AACEncDSPContext *s)
+{
+    static const int sizes[] = { 4, 8, 12, 16, 20, 28, 32, 48, 64, 96 };
+    LOCAL_ALIGNED_32(float, in, [MAX_BAND]);
+
+    declare_func(void, float *, float *, const float *, int);
+
+    randomize_float(in, MAX_BAND);
+
+    if (check_func(s->band_energy, "band_energy")) {
+        float e, ff, e2, ff2;
+
+        for (int i = 0; i < FF_ARRAY_ELEMS(sizes); i++) {
+            call_ref(&e, &ff, in, sizes[i]);
+            call_new(&e2, &ff2, in, sizes[i]);
+
+            if (e != e2 || ff != ff2)
+                fail();
+        }
+
+        bench_new(&e2, &ff2, in, MAX_BAND);
+    }
+
+    report("band_energy");
+}
 
 void checkasm_check_aacencdsp(void)
 {
@@ -67,4 +199,7 @@ void checkasm_check_aacencdsp(void)
     ff_aacenc_dsp_init(&s);
 
     test_abs_pow34(&s);
+    test_quant_bands(&s);
+    test_quant_cost(&s);
+    test_band_energy(&s);
 }
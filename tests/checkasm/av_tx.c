@@ -40,7 +40,13 @@
     } while (0)
 
 static const int check_lens[] = {
-    2, 4, 8, 16, 32, 64, 120, 960, 1024, 1920, 16384,
+    2, 4, 8, 16, 32, 64, 120, 128, 256, 512, 960, 1024, 1920, 2048, 4096,
+    8192, 16384,
+};
+
+static const int check_lens_rdft[] = {
+    4, 8, 16, 32, 64, 120, 128, 256, 512, 960, 1024, 1920, 2048, 4096, 8192,
+    16384,
 };
 
 static AVTXContext *tx_refs[AV_TX_NB][2 /* Direction */][FF_ARRAY_ELEMS(check_lens)] = { 0 };
@@ -113,6 +119,12 @@ void checkasm_check_av_tx(void)
     CHECK_TEMPLATE("float_imdct", AV_TX_FLOAT_MDCT, 1, float, float, check_lens,
                    !float_near_abs_eps_array(out_ref, out_new, EPS, len));
 
+    CHECK_TEMPLATE("float_mdct", AV_TX_FLOAT_MDCT, 0, float, float, check_lens,
+                   !float_near_abs_eps_array(out_ref, out_new, EPS, len));
+
+    CHECK_TEMPLATE("float_rdft", AV_TX_FLOAT_RDFT, 0, float, float, check_lens_rdft,
+                   !float_near_abs_eps_array(out_ref, out_new, EPS, len + 2));
+
     randomize_complex(in, 16384, AVComplexDouble, SCALE_NOOP);
     CHECK_TEMPLATE("double_fft", AV_TX_DOUBLE_FFT, 0, AVComplexDouble, double, check_lens,
                    !double_near_abs_eps_array(out_ref, out_new, EPS, len*2));
@@ -0,0 +1,69 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <string.h>
+
+#include "checkasm.h"
+
+#include "libavcodec/avcodec.h"
+#include "libavcodec/fdctdsp.h"
+
+#include "libavutil/common.h"
+#include "libavutil/internal.h"
+#include "libavutil/mem_internal.h"
+
+static void check_fdct(FDCTDSPContext *h, int depth)
+{
+    LOCAL_ALIGNED_16(int16_t, block0, [64]);
+    LOCAL_ALIGNED_16(int16_t, block1, [64]);
+
+    declare_func(void, int16_t *block);
+
+    if (check_func(h->fdct, "fdct_%d", depth)) {
+        const int max = 1 << depth;
+
+        /* pixel differences as produced by pixblockdsp.diff_pixels */
+        for (int i = 0; i < 64; i++)
+            block0[i] = block1[i] = rnd() % (2 * max - 1) - (max - 1);
+
+        call_ref(block0);
+        call_new(block1);
+        if (memcmp(block0, block1, sizeof(*block0) * 64))
+            fail();
+        bench_new(block1);
+    }
+}
+
+void checkasm_check_fdctdsp(void)
+{
+    static const int depths[] = { 8, 10 };
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(depths); i++) {
+        AVCodecContext avctx = {
+            .bits_per_raw_sample = depths[i],
+            /* only the accurate integer DCT is required to match C */
+            .dct_algo = FF_DCT_INT,
+        };
+        FDCTDSPContext h;
+
+        ff_fdctdsp_init(&h, &avctx);
+        check_fdct(&h, depths[i]);
+    }
+
+    report("fdct");
+}
@@ -438,12 +438,50 @@ static void check_loop_filter_intra(void)
     }
 }
 
+static void check_luma_dc_dequant(void)
+{
+    static const int dequant4_dc[6] = { 10, 11, 13, 14, 16, 18 };
+    LOCAL_ALIGNED_16(int16_t, input, [16 * 2]);
+    LOCAL_ALIGNED_16(int16_t, output0, [16 * 16 * 2]);
+    LOCAL_ALIGNED_16(int16_t, output1, [16 * 16 * 2]);
+    H264DSPContext h;
+    int bit_depth;
+    declare_func(void, int16_t *output, int16_t *input, int qmul);
+
+    for (bit_depth = 8; bit_depth <= 10; bit_depth++) {
+        ff_h264dsp_init(&h, bit_depth, 1);
+        if (check_func(h.h264_luma_dc_dequant_idct, "h264_luma_dc_dequant_idct_%dbpp", bit_depth)) {
+            for (int qp = 0; qp <= 51 + 6 * (bit_depth - 8); qp++) {
+                int qmul = (16 * dequant4_dc[qp % 6]) << (qp / 6);
+
+                for (int i = 0; i < 16; i++) {
+                    int v = (int)(rnd() % 4096) - 2048;
+                    if (bit_depth == 8)
+                        input[i] = v;
+                    else
+                        ((int32_t *)input)[i] = v;
+                }
+                memset(output0, 0, 16 * 16 * SIZEOF_COEF);
+                memset(output1, 0, 16 * 16 * SIZEOF_COEF);
+                call_ref(output0, input, qmul);
+                call_new(output1, input, qmul);
+                if (memcmp(output0, output1, 16 * 16 * SIZEOF_COEF))
+                    fail();
+            }
+            bench_new(output1, input, 16 * 40);
+        }
+    }
+}
+
 void checkasm_check_h264dsp(void)
 {
     check_idct();
     check_idct_multiple();
     report("idct");
 
+    check_luma_dc_dequant();
+    report("luma_dc_dequant");
+
     check_loop_filter();
     report("loop_filter");
 
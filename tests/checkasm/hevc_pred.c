@@ -0,0 +1,153 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <string.h>
+
+#include "checkasm.h"
+
+#include "libavcodec/hevcpred.h"
+
+#include "libavutil/intreadwrite.h"
+#include "libavutil/mem_internal.h"
+
+#define MAX_SIZE 32
+/* the reference arrays start one pixel before the block */
+#define EDGE_SIZE (2 * MAX_SIZE + 1)
+/* in bytes, the functions take it in pixels */
+#define STRIDE (MAX_SIZE * 2)
+
+static void randomize_pixels(uint8_t *buf, int n, int depth)
+{
+    const int mask = (1 << depth) - 1;
+
+    for (int i = 0; i < n; i++) {
+        if (depth > 8)
+            AV_WN16A(buf + 2 * i, rnd() & mask);
+        else
+            buf[i] = rnd() & mask;
+    }
+}
+
+static void randomize_buffers(uint8_t *dst0, uint8_t *dst1,
+                              uint8_t *top, uint8_t *left, int depth)
+{
+    randomize_pixels(dst0, MAX_SIZE * STRIDE / (1 + (depth > 8)), depth);
+    memcpy(dst1, dst0, MAX_SIZE * STRIDE);
+    randomize_pixels(top,  EDGE_SIZE, depth);
+    randomize_pixels(left, EDGE_SIZE, depth);
+}
+
+static void check_pred_planar(HEVCPredContext *h, int depth)
+{
+    LOCAL_ALIGNED_16(uint8_t, dst0, [MAX_SIZE * STRIDE]);
+    LOCAL_ALIGNED_16(uint8_t, dst1, [MAX_SIZE * STRIDE]);
+    LOCAL_ALIGNED_16(uint8_t, top,  [EDGE_SIZE * 2]);
+    LOCAL_ALIGNED_16(uint8_t, left, [EDGE_SIZE * 2]);
+    const int ps = 1 + (depth > 8);
+
+    declare_func(void, uint8_t *src, const uint8_t *top,
+                 const uint8_t *left, ptrdiff_t stride);
+
+    for (int i = 0; i < 4; i++) {
+        int size = 4 << i;
+
+        if (check_func(h->pred_planar[i], "hevc_pred_planar_%dx%d_%d",
+                       size, size, depth)) {
+            randomize_buffers(dst0, dst1, top, left, depth);
+            call_ref(dst0, top + ps, left + ps, STRIDE / ps);
+            call_new(dst1, top + ps, left + ps, STRIDE / ps);
+            if (memcmp(dst0, dst1, MAX_SIZE * STRIDE))
+                fail();
+            bench_new(dst1, top + ps, left + ps, STRIDE / ps);
+        }
+    }
+}
+
+static void check_pred_dc(HEVCPredContext *h, int depth)
+{
+    LOCAL_ALIGNED_16(uint8_t, dst0, [MAX_SIZE * STRIDE]);
+    LOCAL_ALIGNED_16(uint8_t, dst1, [MAX_SIZE * STRIDE]);
+    LOCAL_ALIGNED_16(uint8_t, top,  [EDGE_SIZE * 2]);
+    LOCAL_ALIGNED_16(uint8_t, left, [EDGE_SIZE * 2]);
+    const int ps = 1 + (depth > 8);
+
+    declare_func(void, uint8_t *src, const uint8_t *top,
+                 const uint8_t *left, ptrdiff_t stride,
+                 int log2_size, int c_idx);
+
+    for (int log2_size = 2; log2_size <= 5; log2_size++) {
+        int size = 1 << log2_size;
+
+        for (int c_idx = 0; c_idx < 2; c_idx++) {
+            if (check_func(h->pred_dc, "hevc_pred_dc_%dx%d_%s_%d", size, size,
+                           c_idx ? "chroma" : "luma", depth)) {
+                randomize_buffers(dst0, dst1, top, left, depth);
+                call_ref(dst0, top + ps, left + ps, STRIDE / ps, log2_size, c_idx);
+                call_new(dst1, top + ps, left + ps, STRIDE / ps, log2_size, c_idx);
+                if (memcmp(dst0, dst1, MAX_SIZE * STRIDE))
+                    fail();
+                bench_new(dst1, top + ps, left + ps, STRIDE / ps, log2_size, c_idx);
+            }
+        }
+    }
+}
+
+static void check_pred_angular(HEVCPredContext *h, int depth)
+{
+    LOCAL_ALIGNED_16(uint8_t, dst0, [MAX_SIZE * STRIDE]);
+    LOCAL_ALIGNED_16(uint8_t, dst1, [MAX_SIZE * STRIDE]);
+    LOCAL_ALIGNED_16(uint8_t, top,  [EDGE_SIZE * 2]);
+    LOCAL_ALIGNED_16(uint8_t, left, [EDGE_SIZE * 2]);
+    const int ps = 1 + (depth > 8);
+
+    declare_func(void, uint8_t *src, const uint8_t *top,
+                 const uint8_t *left, ptrdiff_t stride,
+                 int c_idx, int mode);
+
+    for (int i = 0; i < 4; i++) {
+        int size = 4 << i;
+
+        if (check_func(h->pred_angular[i], "hevc_pred_angular_%dx%d_%d",
+                       size, size, depth)) {
+            /* all 33 directions, with and without the luma edge filter */
+            for (int mode = 2; mode <= 34; mode++) {
+                for (int c_idx = 0; c_idx < 2; c_idx++) {
+                    randomize_buffers(dst0, dst1, top, left, depth);
+                    call_ref(dst0, top + ps, left + ps, STRIDE / ps, c_idx, mode);
+                    call_new(dst1, top + ps, left + ps, STRIDE / ps, c_idx, mode);
+                    if (memcmp(dst0, dst1, MAX_SIZE * STRIDE))
+                        fail();
+                }
+            }
+            bench_new(dst1, top + ps, left + ps, STRIDE / ps, 0, 22);
+        }
+    }
+}
+
+void checkasm_check_hevc_pred(void)
+{
+    for (int depth = 8; depth <= 12; depth++) {
+        HEVCPredContext h;
+
+        ff_hevc_pred_init(&h, depth);
+        check_pred_planar(&h, depth);
+        check_pred_dc(&h, depth);
+        check_pred_angular(&h, depth);
+    }
+    report("hevc_pred");
+}
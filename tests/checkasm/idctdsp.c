@@ -92,8 +92,88 @@ static void check_add_put_clamped(void)
     }
 }
 
+static void init_idct_block(int16_t *block0, int16_t *block1, int bits)
+{
+    for (int i = 0; i < 64; i += 8) {
+        /* rows with only a DC coefficient take a shortcut in the C code */
+        int dc_only = rnd() & 1;
+
+        for (int j = 0; j < 8; j++) {
+            int v = dc_only && j ? 0 :
+                    (int)(rnd() % (2 << (bits + 3))) - (1 << (bits + 3));
+            block0[i + j] = block1[i + j] = v;
+        }
+    }
+}
+
+static void check_idct(void)
+{
+    LOCAL_ALIGNED_16(int16_t, block0, [64]);
+    LOCAL_ALIGNED_16(int16_t, block1, [64]);
+    /* 8 rows of 16-bit pixels with 8 guard bytes on each side */
+    LOCAL_ALIGNED_16(uint8_t, dst0, [8 * 32]);
+    LOCAL_ALIGNED_16(uint8_t, dst1, [8 * 32]);
+    static const int depths[] = { 8, 10, 12 };
+
+    for (int d = 0; d < FF_ARRAY_ELEMS(depths); d++) {
+        const int bits = depths[d];
+        AVCodecContext avctx = { .bits_per_raw_sample = bits };
+        IDCTDSPContext h = { 0 };
+
+        ff_idctdsp_init(&h, &avctx);
+
+        if (check_func(h.idct_put, "idctdsp.idct_put_%dbit", bits)) {
+            declare_func(void, uint8_t *, ptrdiff_t, int16_t *);
+
+            init_idct_block(block0, block1, bits);
+            memset(dst0, 0, 8 * 32);
+            memset(dst1, 0, 8 * 32);
+            call_ref(dst0 + 8, 32, block0);
+            call_new(dst1 + 8, 32, block1);
+            if (memcmp(dst0, dst1, 8 * 32))
+                fail();
+            bench_new(dst1 + 8, 32, block1);
+        }
+
+        if (check_func(h.idct_add, "idctdsp.idct_add_%dbit", bits)) {
+            declare_func(void, uint8_t *, ptrdiff_t, int16_t *);
+
+            init_idct_block(block0, block1, bits);
+            for (int i = 0; i < 8 * 32; i += 2) {
+                if (bits > 8) {
+                    uint16_t p = rnd() & ((1 << bits) - 1);
+                    AV_WN16A(dst0 + i, p);
+                    AV_WN16A(dst1 + i, p);
+                } else {
+                    dst0[i]     = dst1[i]     = rnd();
+                    dst0[i + 1] = dst1[i + 1] = rnd();
+                }
+            }
+            call_ref(dst0 + 8, 32, block0);
+            call_new(dst1 + 8, 32, block1);
+            if (memcmp(dst0, dst1, 8 * 32))
+                fail();
+            bench_new(dst1 + 8, 32, block1);
+        }
+
+        if (check_func(h.idct, "idctdsp.idct_%dbit", bits)) {
+            declare_func(void, int16_t *);
+
+            init_idct_block(block0, block1, bits);
+            call_ref(block0);
+            call_new(block1);
+            if (memcmp(block0, block1, 64 * sizeof(*block0)))
+                fail();
+            bench_new(block1);
+        }
+    }
+}
+
 void checkasm_check_idctdsp(void)
 {
     check_add_put_clamped();
     report("idctdsp");
+
+    check_idct();
+    report("idct");
 }
@@ -0,0 +1,135 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <string.h>
+
+#include "checkasm.h"
+
+#include "libavcodec/avcodec.h"
+#include "libavcodec/idctdsp.h"
+#include "libavcodec/mathops.h"
+#include "libavcodec/mpegvideo.h"
+#include "libavcodec/mpegvideodata.h"
+
+#include "libavutil/common.h"
+#include "libavutil/internal.h"
+#include "libavutil/mem_internal.h"
+
+#define UNQUANTIZE_TEST(func) { #func, offsetof(MpegEncContext, func) },
+
+typedef struct {
+    const char *name;
+    size_t offset;
+} test;
+
+static MpegEncContext s;
+
+/* Only the coefficients up to block_last_index in scan order are
+ * non-zero, as in a real block, and the dequantized levels stay
+ * within the range a valid bitstream can produce. */
+static void randomize_block(int16_t *block0, int16_t *block1, int last,
+                            int qscale)
+{
+    const int qscale2 = s.q_scale_type ? ff_mpeg2_non_linear_qscale[qscale]
+                                       : qscale << 1;
+
+    memset(block0, 0, 64 * sizeof(*block0));
+
+    for (int i = 0; i <= last; i++) {
+        int j = s.intra_scantable.permutated[i];
+        int m = FFMAX(s.intra_matrix[j], s.inter_matrix[j]);
+        int max = FFMAX(2047 * 8 / (qscale2 * m), 1);
+
+        block0[j] = (rnd() & 3) ? rnd() % (2 * max + 1) - max : 0;
+    }
+    memcpy(block1, block0, 64 * sizeof(*block0));
+}
+
+static void check_unquantize(int bitexact)
+{
+    LOCAL_ALIGNED_16(int16_t, block0, [64]);
+    LOCAL_ALIGNED_16(int16_t, block1, [64]);
+
+    AVCodecContext avctx = {
+        .flags = bitexact ? AV_CODEC_FLAG_BITEXACT : 0,
+    };
+
+    const test tests[] = {
+        UNQUANTIZE_TEST(dct_unquantize_h263_intra)
+        UNQUANTIZE_TEST(dct_unquantize_h263_inter)
+        UNQUANTIZE_TEST(dct_unquantize_mpeg2_intra)
+        UNQUANTIZE_TEST(dct_unquantize_mpeg2_inter)
+    };
+
+    s.avctx = &avctx;
+    ff_mpv_unquantize_init(&s);
+
+    for (size_t t = 0; t < FF_ARRAY_ELEMS(tests); t++) {
+        void (*func)(MpegEncContext *, int16_t *, int, int) =
+            *(void **)((intptr_t) &s + tests[t].offset);
+
+        /* The bitexact variant only differs for MPEG-2 intra. */
+        if (bitexact && t != 2)
+            continue;
+
+        if (check_func(func, "%s%s", tests[t].name,
+                       bitexact ? "_bitexact" : "")) {
+            declare_func(void, MpegEncContext *s, int16_t *block,
+                         int n, int qscale);
+
+            for (int i = 0; i < 16; i++) {
+                int n = rnd() % 6;
+                int qscale = 1 + rnd() % 31;
+
+                s.block_last_index[n] = rnd() % 64;
+                s.alternate_scan = !(rnd() & 7);
+                s.q_scale_type = rnd() & 1;
+                s.ac_pred = rnd() & 1;
+                s.h263_aic = rnd() & 1;
+                s.y_dc_scale = 8 + rnd() % 8;
+                s.c_dc_scale = 8 + rnd() % 8;
+
+                randomize_block(block0, block1, s.block_last_index[n], qscale);
+                call_ref(&s, block0, n, qscale);
+                call_new(&s, block1, n, qscale);
+                if (memcmp(block0, block1, 64 * sizeof(*block0)))
+                    fail();
+            }
+            bench_new(&s, block1, 0, 8);
+        }
+    }
+}
+
+void checkasm_check_mpegvideo(void)
+{
+    ff_init_scantable_permutation(s.idsp.idct_permutation,
+                                  FF_IDCT_PERM_LIBMPEG2);
+    ff_init_scantable(s.idsp.idct_permutation, &s.intra_scantable,
+                      ff_zigzag_direct);
+    ff_init_scantable(s.idsp.idct_permutation, &s.inter_scantable,
+                      ff_zigzag_direct);
+
+    for (int i = 0; i < 64; i++) {
+        s.intra_matrix[i] = 8 + rnd() % 56;
+        s.inter_matrix[i] = 8 + rnd() % 56;
+    }
+
+    check_unquantize(0);
+    check_unquantize(1);
+    report("dct_unquantize");
+}
@@ -0,0 +1,151 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <string.h>
+
+#include "checkasm.h"
+
+#include "libavcodec/avcodec.h"
+#include "libavcodec/fdctdsp.h"
+#include "libavcodec/idctdsp.h"
+#include "libavcodec/mathops.h"
+#include "libavcodec/mpegvideoenc.h"
+
+#include "libavutil/common.h"
+#include "libavutil/internal.h"
+#include "libavutil/mem_internal.h"
+
+static MpegEncContext s;
+static int q_intra_matrix[32][64], q_inter_matrix[32][64];
+static uint16_t q_intra_matrix16[32][2][64], q_inter_matrix16[32][2][64];
+
+static void check_dct_quantize(void)
+{
+    LOCAL_ALIGNED_16(int16_t, block0, [64]);
+    LOCAL_ALIGNED_16(int16_t, block1, [64]);
+
+    declare_func(int, MpegEncContext *s, int16_t *block, int n,
+                 int qscale, int *overflow);
+
+    if (check_func(s.dct_quantize, "dct_quantize")) {
+        for (int i = 0; i < 32; i++) {
+            int n = rnd() % 6;
+            int qscale = 1 + rnd() % 31;
+            int overflow0, overflow1, ret0, ret1;
+
+            s.mb_intra = rnd() & 1;
+            s.h263_aic = rnd() & 1;
+            s.max_qcoeff = (rnd() & 1) ? 2047 : 127;
+
+            /* intra blocks are pixels, inter blocks are differences */
+            for (int j = 0; j < 64; j++)
+                block0[j] = s.mb_intra ? rnd() & 0xff
+                                       : rnd() % 511 - 255;
+            memcpy(block1, block0, sizeof(*block0) * 64);
+
+            ret0 = call_ref(&s, block0, n, qscale, &overflow0);
+            ret1 = call_new(&s, block1, n, qscale, &overflow1);
+            if (ret0 != ret1 || overflow0 != overflow1 ||
+                memcmp(block0, block1, sizeof(*block0) * 64))
+                fail();
+        }
+        s.mb_intra = 0;
+        bench_new(&s, block1, 0, 4, &(int){ 0 });
+    }
+}
+
+static void check_denoise_dct(void)
+{
+    LOCAL_ALIGNED_16(int16_t, block0, [64]);
+    LOCAL_ALIGNED_16(int16_t, block1, [64]);
+    LOCAL_ALIGNED_16(int, sum0, [2], [64]);
+    LOCAL_ALIGNED_16(int, sum1, [2], [64]);
+    LOCAL_ALIGNED_16(uint16_t, offset, [2], [64]);
+
+    declare_func(void, MpegEncContext *s, int16_t *block);
+
+    if (check_func(s.denoise_dct, "denoise_dct")) {
+        for (int i = 0; i < 2 * 64; i++) {
+            sum0[i / 64][i % 64] = sum1[i / 64][i % 64] = rnd() & 0xffffff;
+            offset[i / 64][i % 64] = rnd() & 0x7ff;
+        }
+        s.dct_offset = offset;
+
+        for (int intra = 0; intra < 2; intra++) {
+            s.mb_intra = intra;
+            for (int j = 0; j < 64; j++)
+                block0[j] = (rnd() & 1) ? rnd() % 8191 - 4095 : 0;
+            memcpy(block1, block0, sizeof(*block0) * 64);
+
+            s.dct_error_sum = sum0;
+            call_ref(&s, block0);
+            s.dct_error_sum = sum1;
+            call_new(&s, block1);
+            if (memcmp(block0, block1, sizeof(*block0) * 64) ||
+                memcmp(sum0, sum1, sizeof(*sum0) * 2))
+                fail();
+        }
+        bench_new(&s, block1);
+        s.dct_error_sum = NULL;
+    }
+}
+
+void checkasm_check_mpegvideoenc(void)
+{
+    /* Only the accurate DCT has to produce the same output as C. */
+    AVCodecContext avctx = { .dct_algo = FF_DCT_INT };
+    uint16_t intra_matrix[64], inter_matrix[64];
+
+    s.avctx = &avctx;
+    ff_fdctdsp_init(&s.fdsp, &avctx);
+    s.idsp.perm_type = FF_IDCT_PERM_LIBMPEG2;
+    ff_init_scantable_permutation(s.idsp.idct_permutation, s.idsp.perm_type);
+    ff_init_scantable(s.idsp.idct_permutation, &s.intra_scantable,
+                      ff_zigzag_direct);
+    ff_init_scantable(s.idsp.idct_permutation, &s.inter_scantable,
+                      ff_zigzag_direct);
+    s.y_dc_scale = 8;
+    s.c_dc_scale = 8;
+    s.intra_quant_bias = 3 << (QUANT_BIAS_SHIFT - 3);
+    s.inter_quant_bias = -(1 << (QUANT_BIAS_SHIFT - 2));
+
+    for (int i = 0; i < 64; i++) {
+        intra_matrix[i] = 8 + rnd() % 248;
+        inter_matrix[i] = 8 + rnd() % 248;
+    }
+    ff_convert_matrix(&s, q_intra_matrix, q_intra_matrix16, intra_matrix,
+                      s.intra_quant_bias, 1, 31, 1);
+    ff_convert_matrix(&s, q_inter_matrix, q_inter_matrix16, inter_matrix,
+                      s.inter_quant_bias, 1, 31, 0);
+    s.q_intra_matrix        = q_intra_matrix;
+    s.q_chroma_intra_matrix = q_intra_matrix;
+    s.q_inter_matrix        = q_inter_matrix;
+    s.q_intra_matrix16        = q_intra_matrix16;
+    s.q_chroma_intra_matrix16 = q_intra_matrix16;
+    s.q_inter_matrix16        = q_inter_matrix16;
+
+    s.dct_quantize = NULL;
+    s.denoise_dct  = NULL;
+    ff_dct_encode_init(&s);
+
+    check_dct_quantize();
+    report("dct_quantize");
+
+    check_denoise_dct();
+    report("denoise_dct");
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "checkasm.h"
+#include "libavutil/mem_internal.h"
+#include "libavutil/pixelutils.h"
+
+#define STRIDE    64
+#define BUF_SIZE  (STRIDE * 32)
+
+#define randomize_buffer(buf)                 \
+    do {                                      \
+        for (int j = 0; j < BUF_SIZE; j++)    \
+            buf[j] = rnd();                   \
+    } while (0)
+
+void checkasm_check_pixelutils(void)
+{
+    LOCAL_ALIGNED_32(uint8_t, buf1, [BUF_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, buf2, [BUF_SIZE]);
+    /* src1 and src2 unaligned, src1 aligned, both aligned */
+    static const char *const prefixes[] = { "", "u_", "a_" };
+
+    declare_func(int, const uint8_t *src1, ptrdiff_t stride1,
+                 const uint8_t *src2, ptrdiff_t stride2);
+
+    for (int aligned = 0; aligned < 3; aligned++) {
+        for (int bits = 1; bits <= 5; bits++) {
+            const int size = 1 << bits;
+            av_pixelutils_sad_fn sad = av_pixelutils_get_sad_fn(bits, bits,
+                                                                 aligned, NULL);
+
+            if (check_func(sad, "sad_%s%dx%d", prefixes[aligned], size, size)) {
+                const uint8_t *src1 = buf1 + (aligned >= 1 ? 0 : rnd() % 16);
+                const uint8_t *src2 = buf2 + (aligned >= 2 ? 0 : rnd() % 16);
+                int ref, new;
+
+                randomize_buffer(buf1);
+                randomize_buffer(buf2);
+                ref = call_ref(src1, STRIDE, src2, STRIDE);
+                new = call_new(src1, STRIDE, src2, STRIDE);
+                if (ref != new) {
+                    fprintf(stderr, "sad: %d != %d\n", ref, new);
+                    fail();
+                }
+
+                memset(buf1, 0xff, BUF_SIZE);
+                memset(buf2, 0x00, BUF_SIZE);
+                ref = call_ref(src1, STRIDE, src2, STRIDE);
+                new = call_new(src1, STRIDE, src2, STRIDE);
+                if (ref != new) {
+                    fprintf(stderr, "sad: %d != %d\n", ref, new);
+                    fail();
+                }
+                bench_new(src1, STRIDE, src2, STRIDE);
+            }
+        }
+    }
+    report("sad");
+}
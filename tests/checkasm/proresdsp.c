@@ -0,0 +1,70 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <string.h>
+
+#include "checkasm.h"
+
+#include "libavcodec/proresdsp.h"
+
+#include "libavutil/mem_internal.h"
+
+static void check_idct_put(int bits)
+{
+    LOCAL_ALIGNED_16(int16_t, block0, [64]);
+    LOCAL_ALIGNED_16(int16_t, block1, [64]);
+    LOCAL_ALIGNED_16(int16_t, qmat, [64]);
+    /* 8 rows of 8 pixels with 4 guard pixels on each side */
+    LOCAL_ALIGNED_16(uint16_t, dst0, [8 * 16]);
+    LOCAL_ALIGNED_16(uint16_t, dst1, [8 * 16]);
+    ProresDSPContext dsp;
+
+    declare_func(void, uint16_t *, ptrdiff_t, int16_t *, const int16_t *);
+
+    if (ff_proresdsp_init(&dsp, bits) < 0)
+        return;
+
+    if (check_func(dsp.idct_put, "prores_idct_put_%d", bits)) {
+        for (int i = 0; i < 64; i += 8) {
+            /* rows with only a DC coefficient take a shortcut in the C code */
+            int dc_only = rnd() & 1;
+
+            for (int j = 0; j < 8; j++) {
+                int v = dc_only && j ? 0 : (int)(rnd() % 512) - 256;
+
+                block0[i + j] = block1[i + j] = v;
+                qmat[i + j] = 1 + rnd() % 64;
+            }
+        }
+        memset(dst0, 0, 8 * 16 * sizeof(*dst0));
+        memset(dst1, 0, 8 * 16 * sizeof(*dst1));
+
+        call_ref(dst0 + 4, 16 * sizeof(*dst0), block0, qmat);
+        call_new(dst1 + 4, 16 * sizeof(*dst1), block1, qmat);
+        if (memcmp(dst0, dst1, 8 * 16 * sizeof(*dst0)))
+            fail();
+        bench_new(dst1 + 4, 16 * sizeof(*dst1), block1, qmat);
+    }
+}
+
+void checkasm_check_proresdsp(void)
+{
+    check_idct_put(10);
+    check_idct_put(12);
+    report("idct_put");
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "checkasm.h"
+#include "libavfilter/scene_sad.h"
+#include "libavutil/intreadwrite.h"
+#include "libavutil/mem_internal.h"
+
+#define WIDTH    256
+#define HEIGHT   16
+#define STRIDE   (WIDTH * 2)
+#define BUF_SIZE (STRIDE * HEIGHT)
+
+#define randomize_buffers(buf1, buf2)                   \
+    do {                                                \
+        for (int j = 0; j < BUF_SIZE; j += 4) {         \
+            AV_WN32A(buf1 + j, rnd());                  \
+            AV_WN32A(buf2 + j, rnd());                  \
+        }                                               \
+    } while (0)
+
+static void check_scene_sad(int depth)
+{
+    LOCAL_ALIGNED_32(uint8_t, src1, [BUF_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, src2, [BUF_SIZE]);
+    ff_scene_sad_fn sad = ff_scene_sad_get_fn(depth);
+
+    declare_func(void, SCENE_SAD_PARAMS);
+
+    if (check_func(sad, "scene_sad%s", depth > 8 ? "16" : "")) {
+        static const ptrdiff_t widths[] = { 1, 15, 16, 33, 100, WIDTH };
+        uint64_t sum;
+
+        for (int i = 0; i < FF_ARRAY_ELEMS(widths); i++) {
+            const ptrdiff_t width = widths[i];
+            const ptrdiff_t height = 1 + rnd() % HEIGHT;
+            uint64_t sum_ref = 0, sum_new = 0;
+
+            randomize_buffers(src1, src2);
+            call_ref(src1, STRIDE, src2, STRIDE, width, height, &sum_ref);
+            call_new(src1, STRIDE, src2, STRIDE, width, height, &sum_new);
+            if (sum_ref != sum_new) {
+                fprintf(stderr, "scene_sad: %"PRIu64" != %"PRIu64" "
+                        "(width %td, height %td)\n", sum_ref, sum_new,
+                        width, height);
+                fail();
+            }
+        }
+        bench_new(src1, STRIDE, src2, STRIDE, WIDTH, HEIGHT, &sum);
+    }
+}
+
+void checkasm_check_scene_sad(void)
+{
+    check_scene_sad(8);
+    report("scene_sad8");
+
+    check_scene_sad(16);
+    report("scene_sad16");
+}
@@ -0,0 +1,372 @@
+/*
+ *
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#include "libavutil/common.h"
+#include "libavutil/intreadwrite.h"
+#include "libavutil/mem.h"
+#include "libavutil/mem_internal.h"
+#include "libavutil/samplefmt.h"
+
+#include "libswresample/audioconvert.h"
+#include "libswresample/resample.h"
+#include "libswresample/swresample_internal.h"
+
+#include "checkasm.h"
+
+#define LEN 256
+#define PHASES 16
+#define MAX_FILTER 97
+
+#define randomize_buffers(buf, size)      \
+    do {                                  \
+        int j;                            \
+        for (j = 0; j < size; j += 4)     \
+            AV_WN32(buf + j, rnd());      \
+    } while (0)
+
+static double rnd_unit(void)
+{
+    return (int32_t)rnd() / (double)(1U << 31);
+}
+
+/* Fills n samples of fmt with random values within scale times full range.
+ * Integers are limited to their range, floats may go beyond it. */
+static void fill_samples(uint8_t *buf, enum AVSampleFormat fmt, int n,
+                         double scale)
+{
+    double iscale = FFMIN(scale, 1.0);
+
+    for (int i = 0; i < n; i++) {
+        switch (av_get_packed_sample_fmt(fmt)) {
+        case AV_SAMPLE_FMT_S16:
+            ((int16_t *)buf)[i] = rnd_unit() * iscale * INT16_MAX;
+            break;
+        case AV_SAMPLE_FMT_S32:
+            ((int32_t *)buf)[i] = rnd_unit() * iscale * INT32_MAX;
+            break;
+        case AV_SAMPLE_FMT_FLT:
+            ((float *)buf)[i] = rnd_unit() * scale;
+            break;
+        case AV_SAMPLE_FMT_DBL:
+            ((double *)buf)[i] = rnd_unit() * scale;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static int cmp_samples(const uint8_t *ref, const uint8_t *new,
+                       enum AVSampleFormat fmt, int n, double eps)
+{
+    switch (av_get_packed_sample_fmt(fmt)) {
+    case AV_SAMPLE_FMT_FLT:
+        return !float_near_abs_eps_array((const float *)ref,
+                                         (const float *)new, eps, n);
+    case AV_SAMPLE_FMT_DBL:
+        return !double_near_abs_eps_array((const double *)ref,
+                                          (const double *)new, eps, n);
+    default:
+        return memcmp(ref, new, n * av_get_bytes_per_sample(fmt));
+    }
+}
+
+static const enum AVSampleFormat resample_fmts[] = {
+    AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_S32P,
+    AV_SAMPLE_FMT_FLTP, AV_SAMPLE_FMT_DBLP,
+};
+
+static void check_resample_common(void)
+{
+    static const int filter_lengths[] = { 1, 8, 13, 32, MAX_FILTER };
+    LOCAL_ALIGNED_32(uint8_t, filter, [PHASES * (MAX_FILTER + 7) * 8]);
+    LOCAL_ALIGNED_32(uint8_t, src, [(4 * LEN + MAX_FILTER) * 8]);
+    LOCAL_ALIGNED_32(uint8_t, dst0, [LEN * 8]);
+    LOCAL_ALIGNED_32(uint8_t, dst1, [LEN * 8]);
+
+    declare_func(int, ResampleContext *c, void *dst, const void *src,
+                 int n, int update_ctx);
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(resample_fmts); i++) {
+        enum AVSampleFormat fmt = resample_fmts[i];
+        const char *name = av_get_sample_fmt_name(fmt);
+        int bps = av_get_bytes_per_sample(fmt);
+
+        for (int j = 0; j < FF_ARRAY_ELEMS(filter_lengths); j++) {
+            int len = filter_lengths[j];
+            ResampleContext c = {
+                .filter_bank   = filter,
+                .filter_length = len,
+                .filter_alloc  = FFALIGN(len, 8),
+                .phase_count   = PHASES,
+                .src_incr      = 7,
+                .dst_incr_div  = PHASES + 5,
+                .dst_incr_mod  = 3,
+                .format        = fmt,
+                .felem_size    = bps,
+            };
+            ResampleContext c0, c1;
+            int ret0, ret1;
+
+            /* Keep the sums within range for the integer formats. */
+            fill_samples(filter, fmt, PHASES * c.filter_alloc, 0.5 / len);
+            fill_samples(src, fmt, 4 * LEN + MAX_FILTER, 1.0);
+
+            swri_resample_dsp_init(&c);
+            if (!check_func(c.dsp.resample_common, "resample_common_%s_%d",
+                            name, len))
+                continue;
+
+            for (int full = 0; full <= (fmt == AV_SAMPLE_FMT_S16P); full++) {
+                if (full) {
+                    /* Full-scale s16: the even and odd partial sums still
+                     * fit in 32 bits, but their total does not. */
+                    for (int k = 0; k < PHASES * c.filter_alloc; k++)
+                        ((int16_t *)filter)[k] = FFMIN(3 * INT16_MAX / len, INT16_MAX);
+                    for (int k = 0; k < 4 * LEN + MAX_FILTER; k++)
+                        ((int16_t *)src)[k] = INT16_MAX;
+                }
+
+                c.index = rnd() % (2 * PHASES);
+                c.frac  = rnd() % c.src_incr;
+                c0 = c1 = c;
+                memset(dst0, 0, LEN * bps);
+                memset(dst1, 0, LEN * bps);
+                ret0 = call_ref(&c0, dst0, src, LEN, 1);
+                ret1 = call_new(&c1, dst1, src, LEN, 1);
+                if (ret0 != ret1 || c0.index != c1.index || c0.frac != c1.frac ||
+                    cmp_samples(dst0, dst1, fmt, LEN,
+                                bps == 4 ? 8 * FLT_EPSILON : 8 * DBL_EPSILON))
+                    fail();
+            }
+            bench_new(&c1, dst1, src, LEN, 0);
+        }
+    }
+}
+
+static void check_resample_one(void)
+{
+    LOCAL_ALIGNED_32(uint8_t, src, [4 * LEN * 8]);
+    LOCAL_ALIGNED_32(uint8_t, dst0, [LEN * 8]);
+    LOCAL_ALIGNED_32(uint8_t, dst1, [LEN * 8]);
+
+    declare_func(void, void *dst, const void *src, int n, int64_t index,
+                 int64_t incr);
+
+    randomize_buffers(src, 4 * LEN * 8);
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(resample_fmts); i++) {
+        enum AVSampleFormat fmt = resample_fmts[i];
+        int bps = av_get_bytes_per_sample(fmt);
+        ResampleContext c = { .format = fmt };
+
+        swri_resample_dsp_init(&c);
+        if (check_func(c.dsp.resample_one, "resample_one_%s",
+                       av_get_sample_fmt_name(fmt))) {
+            int64_t index = rnd() % (LEN << 16) * 65536LL;
+            int64_t incr  = (rnd() % (3 << 16) + 1) * 65536LL;
+
+            memset(dst0, 0, LEN * bps);
+            memset(dst1, 0, LEN * bps);
+            call_ref(dst0, src, LEN, index, incr);
+            call_new(dst1, src, LEN, index, incr);
+            if (memcmp(dst0, dst1, LEN * bps))
+                fail();
+            bench_new(dst1, src, LEN, index, incr);
+        }
+    }
+}
+
+static void convert_ref(const AudioConvert *ac, uint8_t **dst,
+                        const uint8_t **src, enum AVSampleFormat out_fmt,
+                        enum AVSampleFormat in_fmt, int channels, int len)
+{
+    int obps = av_get_bytes_per_sample(out_fmt);
+    int ibps = av_get_bytes_per_sample(in_fmt);
+    int os = av_sample_fmt_is_planar(out_fmt) ? obps : obps * channels;
+    int is = av_sample_fmt_is_planar(in_fmt)  ? ibps : ibps * channels;
+
+    for (int ch = 0; ch < channels; ch++) {
+        uint8_t *po = av_sample_fmt_is_planar(out_fmt) ? dst[ch]
+                                                       : dst[0] + ch * obps;
+        const uint8_t *pi = av_sample_fmt_is_planar(in_fmt) ? src[ch]
+                                                            : src[0] + ch * ibps;
+
+        ac->conv_f(po, pi, is, os, po + os * len);
+    }
+}
+
+static void check_audio_convert(void)
+{
+    static const struct {
+        enum AVSampleFormat out, in;
+        int channels;
+    } convs[] = {
+        { AV_SAMPLE_FMT_S32P, AV_SAMPLE_FMT_S16P, 1 },
+        { AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_S32P, 1 },
+        { AV_SAMPLE_FMT_FLTP, AV_SAMPLE_FMT_S16P, 1 },
+        { AV_SAMPLE_FMT_FLTP, AV_SAMPLE_FMT_S32P, 1 },
+        { AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_FLTP, 1 },
+        { AV_SAMPLE_FMT_S32P, AV_SAMPLE_FMT_FLTP, 1 },
+        { AV_SAMPLE_FMT_S16,  AV_SAMPLE_FMT_S16P, 2 },
+        { AV_SAMPLE_FMT_S32,  AV_SAMPLE_FMT_S32P, 2 },
+        { AV_SAMPLE_FMT_FLT,  AV_SAMPLE_FMT_FLTP, 2 },
+        { AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_S16,  2 },
+        { AV_SAMPLE_FMT_S32P, AV_SAMPLE_FMT_S32,  2 },
+        { AV_SAMPLE_FMT_FLTP, AV_SAMPLE_FMT_FLT,  2 },
+        { AV_SAMPLE_FMT_S16,  AV_SAMPLE_FMT_FLTP, 2 },
+    };
+    LOCAL_ALIGNED_32(uint8_t, src, [2 * LEN * 4]);
+    LOCAL_ALIGNED_32(uint8_t, dst0, [2 * LEN * 4]);
+    LOCAL_ALIGNED_32(uint8_t, dst1, [2 * LEN * 4]);
+
+    declare_func(void, uint8_t **dst, const uint8_t **src, int len);
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(convs); i++) {
+        enum AVSampleFormat out_fmt = convs[i].out, in_fmt = convs[i].in;
+        int channels = convs[i].channels;
+        int obps = av_get_bytes_per_sample(out_fmt);
+        int ibps = av_get_bytes_per_sample(in_fmt);
+        AudioConvert *ac = swri_audio_convert_alloc(out_fmt, in_fmt,
+                                                    channels, NULL, 0);
+
+        if (!ac) {
+            fail();
+            continue;
+        }
+
+        if (ac->simd_f &&
+            check_func(ac->simd_f, "audio_convert_%s_to_%s_%dch",
+                       av_get_sample_fmt_name(in_fmt),
+                       av_get_sample_fmt_name(out_fmt), channels)) {
+            const uint8_t *in[2] = { src, src + LEN * ibps };
+            uint8_t *out0[2] = { dst0, dst0 + LEN * obps };
+            uint8_t *out1[2] = { dst1, dst1 + LEN * obps };
+
+            /* Overshoot the float range to test clipping. */
+            fill_samples(src, in_fmt, 2 * LEN, 1.2);
+            memset(dst0, 0, 2 * LEN * 4);
+            memset(dst1, 0, 2 * LEN * 4);
+            convert_ref(ac, out0, in, out_fmt, in_fmt, channels, LEN);
+            call_new(out1, in, LEN);
+            if (memcmp(dst0, dst1, channels * LEN * obps))
+                fail();
+            bench_new(out1, in, LEN);
+        }
+
+        swri_audio_convert_free(&ac);
+    }
+}
+
+static void check_rematrix(void)
+{
+    static const enum AVSampleFormat fmts[] = {
+        AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_S32P,
+        AV_SAMPLE_FMT_FLTP, AV_SAMPLE_FMT_DBLP,
+    };
+    LOCAL_ALIGNED_32(uint8_t, src0, [LEN * 8]);
+    LOCAL_ALIGNED_32(uint8_t, src1, [LEN * 8]);
+    LOCAL_ALIGNED_32(uint8_t, dst0, [LEN * 8]);
+    LOCAL_ALIGNED_32(uint8_t, dst1, [LEN * 8]);
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(fmts); i++) {
+        enum AVSampleFormat fmt = fmts[i];
+        int bps = av_get_bytes_per_sample(fmt);
+        /* The second 16-bit pass uses coefficients large enough to clip. */
+        double scale = i == 1 ? 2.0 : 0.5;
+        const char *suffix = i == 1 ? "_clip" : "";
+        SwrContext *s = av_mallocz(sizeof(*s));
+
+        if (!s) {
+            fail();
+            continue;
+        }
+
+        s->rematrix_custom = 1;
+        s->used_ch_layout.nb_channels = 2;
+        s->out.ch_count = 2;
+        s->midbuf.fmt = fmt;
+        for (int j = 0; j < 2; j++)
+            for (int k = 0; k < 2; k++)
+                s->matrix[j][k] = (rnd() & 1 ? scale : -scale) *
+                                  (0.5 + 0.5 * fabs(rnd_unit()));
+
+        if (swri_rematrix_init(s) < 0) {
+            fail();
+            goto next;
+        }
+
+        fill_samples(src0, fmt, LEN, 1.0);
+        fill_samples(src1, fmt, LEN, 1.0);
+
+        if (check_func(s->mix_1_1_simd, "mix_1_1_%s%s",
+                       av_get_sample_fmt_name(fmt), suffix)) {
+            declare_func(void, void *out, const void *in, void *coeffp,
+                         integer index, integer len);
+
+            memset(dst0, 0, LEN * bps);
+            memset(dst1, 0, LEN * bps);
+            s->mix_1_1_f(dst0, src0, s->native_matrix, 1, LEN);
+            call_new(dst1, src0, s->native_simd_matrix, 1, LEN);
+            if (cmp_samples(dst0, dst1, fmt, LEN,
+                            bps == 4 ? 2 * FLT_EPSILON : 2 * DBL_EPSILON))
+                fail();
+            bench_new(dst1, src0, s->native_simd_matrix, 1, LEN);
+        }
+
+        if (check_func(s->mix_2_1_simd, "mix_2_1_%s%s",
+                       av_get_sample_fmt_name(fmt), suffix)) {
+            declare_func(void, void *out, const void *in1, const void *in2,
+                         void *coeffp, integer index1, integer index2,
+                         integer len);
+
+            memset(dst0, 0, LEN * bps);
+            memset(dst1, 0, LEN * bps);
+            s->mix_2_1_f(dst0, src0, src1, s->native_matrix, 2, 3, LEN);
+            call_new(dst1, src0, src1, s->native_simd_matrix, 2, 3, LEN);
+            if (cmp_samples(dst0, dst1, fmt, LEN,
+                            bps == 4 ? 4 * FLT_EPSILON : 4 * DBL_EPSILON))
+                fail();
+            bench_new(dst1, src0, src1, s->native_simd_matrix, 2, 3, LEN);
+        }
+
+next:
+        swri_rematrix_free(s);
+        av_free(s);
+    }
+}
+
+void checkasm_check_sw_resample(void)
+{
+    check_resample_common();
+    report("resample_common");
+
+    check_resample_one();
+    report("resample_one");
+
+    check_audio_convert();
+    report("audio_convert");
+
+    check_rematrix();
+    report("rematrix");
+}
@@ -22,6 +22,7 @@
 #include "libavutil/common.h"
 #include "libavutil/intreadwrite.h"
 #include "libavutil/mem_internal.h"
+#include "libavutil/pixdesc.h"
 
 #include "libswscale/swscale.h"
 #include "libswscale/swscale_internal.h"
@@ -358,6 +359,207 @@ static void check_hscale(void)
     sws_freeContext(ctx);
 }
 
+static void check_input(void)
+{
+    static const enum AVPixelFormat input_fmts[] = {
+        AV_PIX_FMT_RGB24, AV_PIX_FMT_BGR24,
+        AV_PIX_FMT_RGBA,  AV_PIX_FMT_BGRA,
+        AV_PIX_FMT_ARGB,  AV_PIX_FMT_ABGR,
+        AV_PIX_FMT_NV12,  AV_PIX_FMT_NV21,
+        AV_PIX_FMT_P010LE,
+        AV_PIX_FMT_Y210LE, AV_PIX_FMT_Y212LE,
+    };
+    static const int input_sizes[] = {8, 24, 128, 144, 256, 512};
+#define INPUT_BUF_SIZE (LARGEST_INPUT_SIZE * 8)
+    LOCAL_ALIGNED_16(uint8_t, src, [INPUT_BUF_SIZE]);
+    LOCAL_ALIGNED_16(uint8_t, dst0_u, [LARGEST_INPUT_SIZE * 2]);
+    LOCAL_ALIGNED_16(uint8_t, dst0_v, [LARGEST_INPUT_SIZE * 2]);
+    LOCAL_ALIGNED_16(uint8_t, dst1_u, [LARGEST_INPUT_SIZE * 2]);
+    LOCAL_ALIGNED_16(uint8_t, dst1_v, [LARGEST_INPUT_SIZE * 2]);
+
+    randomize_buffers(src, INPUT_BUF_SIZE);
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(input_fmts); i++) {
+        const enum AVPixelFormat src_fmt = input_fmts[i];
+        const char *name = av_get_pix_fmt_name(src_fmt);
+
+        for (int half = 0; half <= isAnyRGB(src_fmt); half++) {
+            struct SwsContext *ctx;
+            uint32_t *tab;
+
+            ctx = sws_getContext(LARGEST_INPUT_SIZE, 2, src_fmt,
+                                 LARGEST_INPUT_SIZE, 2,
+                                 half ? AV_PIX_FMT_YUV420P : AV_PIX_FMT_YUV444P,
+                                 SWS_ACCURATE_RND | SWS_BITEXACT, NULL, NULL, NULL);
+            if (!ctx) {
+                fail();
+                continue;
+            }
+            tab = (uint32_t *)ctx->input_rgb2yuv_table;
+
+            for (int j = 0; j < FF_ARRAY_ELEMS(input_sizes); j++) {
+                const int w = input_sizes[j];
+
+                if (!half) {
+                    declare_func(void, uint8_t *dst, const uint8_t *src,
+                                 const uint8_t *src2, const uint8_t *src3,
+                                 int width, uint32_t *pal, void *opq);
+
+                    if (ctx->lumToYV12 &&
+                        check_func(ctx->lumToYV12, "%s_to_y_%d", name, w)) {
+                        memset(dst0_u, 0xFF, LARGEST_INPUT_SIZE * 2);
+                        memset(dst1_u, 0xFF, LARGEST_INPUT_SIZE * 2);
+
+                        call_ref(dst0_u, src, NULL, NULL, w, tab, NULL);
+                        call_new(dst1_u, src, NULL, NULL, w, tab, NULL);
+                        if (memcmp(dst0_u, dst1_u, LARGEST_INPUT_SIZE * 2))
+                            fail();
+                        if (w == LARGEST_INPUT_SIZE)
+                            bench_new(dst1_u, src, NULL, NULL, w, tab, NULL);
+                    }
+                }
+                {
+                    declare_func(void, uint8_t *dstU, uint8_t *dstV,
+                                 const uint8_t *src0, const uint8_t *src1,
+                                 const uint8_t *src2, int width,
+                                 uint32_t *pal, void *opq);
+
+                    if (ctx->chrToYV12 &&
+                        check_func(ctx->chrToYV12, "%s_to_uv%s_%d", name,
+                                   half ? "_half" : "", w)) {
+                        memset(dst0_u, 0xFF, LARGEST_INPUT_SIZE * 2);
+                        memset(dst0_v, 0xFF, LARGEST_INPUT_SIZE * 2);
+                        memset(dst1_u, 0xFF, LARGEST_INPUT_SIZE * 2);
+                        memset(dst1_v, 0xFF, LARGEST_INPUT_SIZE * 2);
+
+                        call_ref(dst0_u, dst0_v, NULL, src, src, w, tab, NULL);
+                        call_new(dst1_u, dst1_v, NULL, src, src, w, tab, NULL);
+                        if (memcmp(dst0_u, dst1_u, LARGEST_INPUT_SIZE * 2) ||
+                            memcmp(dst0_v, dst1_v, LARGEST_INPUT_SIZE * 2))
+                            fail();
+                        if (w == LARGEST_INPUT_SIZE)
+                            bench_new(dst1_u, dst1_v, NULL, src, src, w, tab, NULL);
+                    }
+                }
+            }
+            sws_freeContext(ctx);
+        }
+    }
+}
+
+static void check_output_p01x(void)
+{
+    static const enum AVPixelFormat output_fmts[] = {
+        AV_PIX_FMT_P010LE, AV_PIX_FMT_P012LE,
+    };
+    static const int input_sizes[] = {8, 24, 128, 144, 256, 512};
+    static const int filter_sizes[] = {1, 2, 3, 4, 8, 16};
+    const int16_t *src_u[LARGEST_FILTER], *src_v[LARGEST_FILTER];
+    LOCAL_ALIGNED_16(int16_t, src_pixels_u, [LARGEST_FILTER * LARGEST_INPUT_SIZE]);
+    LOCAL_ALIGNED_16(int16_t, src_pixels_v, [LARGEST_FILTER * LARGEST_INPUT_SIZE]);
+    LOCAL_ALIGNED_16(int16_t, filter_coeff, [LARGEST_FILTER]);
+    LOCAL_ALIGNED_16(uint8_t, dst0, [LARGEST_INPUT_SIZE * 4]);
+    LOCAL_ALIGNED_16(uint8_t, dst1, [LARGEST_INPUT_SIZE * 4]);
+    LOCAL_ALIGNED_8(uint8_t, dither, [8]);
+
+    randomize_buffers(dither, 8);
+    randomize_buffers((uint8_t*)src_pixels_u, LARGEST_FILTER * LARGEST_INPUT_SIZE * sizeof(int16_t));
+    randomize_buffers((uint8_t*)src_pixels_v, LARGEST_FILTER * LARGEST_INPUT_SIZE * sizeof(int16_t));
+    for (int i = 0; i < LARGEST_FILTER; i++) {
+        src_u[i] = &src_pixels_u[i * LARGEST_INPUT_SIZE];
+        src_v[i] = &src_pixels_v[i * LARGEST_INPUT_SIZE];
+    }
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(output_fmts); i++) {
+        const enum AVPixelFormat dst_fmt = output_fmts[i];
+        const char *name = av_get_pix_fmt_name(dst_fmt);
+        struct SwsContext *ctx;
+
+        // Scale horizontally, so that no unscaled converter replaces the
+        // output functions.
+        ctx = sws_getContext(LARGEST_INPUT_SIZE / 2, 2, AV_PIX_FMT_YUV420P,
+                             LARGEST_INPUT_SIZE, 2, dst_fmt,
+                             SWS_ACCURATE_RND | SWS_BITEXACT, NULL, NULL, NULL);
+        if (!ctx) {
+            fail();
+            continue;
+        }
+
+        for (int j = 0; j < FF_ARRAY_ELEMS(input_sizes); j++) {
+            const int w = input_sizes[j];
+
+            {
+                declare_func(void, const int16_t *src, uint8_t *dest,
+                             int dstW, const uint8_t *dither, int offset);
+
+                if (check_func(ctx->yuv2plane1, "%s_plane1_%d", name, w)) {
+                    memset(dst0, 0, LARGEST_INPUT_SIZE * 4);
+                    memset(dst1, 0, LARGEST_INPUT_SIZE * 4);
+
+                    call_ref(src_pixels_u, dst0, w, dither, 0);
+                    call_new(src_pixels_u, dst1, w, dither, 0);
+                    if (memcmp(dst0, dst1, LARGEST_INPUT_SIZE * 4))
+                        fail();
+                    if (w == LARGEST_INPUT_SIZE)
+                        bench_new(src_pixels_u, dst1, w, dither, 0);
+                }
+            }
+
+            for (int fsi = 0; fsi < FF_ARRAY_ELEMS(filter_sizes); fsi++) {
+                const int filter_size = filter_sizes[fsi];
+
+                // Same filter shape as in check_yuv2yuvX(): the coefficients
+                // add up to about 4096 and the sums can't overflow.
+                for (int k = 0; k < filter_size; k++)
+                    filter_coeff[k] = -((1 << 12) / FFMAX(filter_size - 1, 1));
+                filter_coeff[rnd() % filter_size] = (1 << 13) - 1;
+
+                {
+                    declare_func(void, const int16_t *filter, int filterSize,
+                                 const int16_t **src, uint8_t *dest, int dstW,
+                                 const uint8_t *dither, int offset);
+
+                    if (check_func(ctx->yuv2planeX, "%s_planeX_%d_%d", name,
+                                   filter_size, w)) {
+                        memset(dst0, 0, LARGEST_INPUT_SIZE * 4);
+                        memset(dst1, 0, LARGEST_INPUT_SIZE * 4);
+
+                        call_ref(filter_coeff, filter_size, src_u, dst0, w, dither, 0);
+                        call_new(filter_coeff, filter_size, src_u, dst1, w, dither, 0);
+                        if (memcmp(dst0, dst1, LARGEST_INPUT_SIZE * 4))
+                            fail();
+                        if (w == LARGEST_INPUT_SIZE)
+                            bench_new(filter_coeff, filter_size, src_u, dst1, w, dither, 0);
+                    }
+                }
+                {
+                    declare_func(void, enum AVPixelFormat dstFormat,
+                                 const uint8_t *chrDither, const int16_t *chrFilter,
+                                 int chrFilterSize, const int16_t **chrUSrc,
+                                 const int16_t **chrVSrc, uint8_t *dest, int chrDstW);
+
+                    if (check_func(ctx->yuv2nv12cX, "%s_chromaX_%d_%d", name,
+                                   filter_size, w)) {
+                        memset(dst0, 0, LARGEST_INPUT_SIZE * 4);
+                        memset(dst1, 0, LARGEST_INPUT_SIZE * 4);
+
+                        call_ref(dst_fmt, dither, filter_coeff, filter_size,
+                                 src_u, src_v, dst0, w);
+                        call_new(dst_fmt, dither, filter_coeff, filter_size,
+                                 src_u, src_v, dst1, w);
+                        if (memcmp(dst0, dst1, LARGEST_INPUT_SIZE * 4))
+                            fail();
+                        if (w == LARGEST_INPUT_SIZE)
+                            bench_new(dst_fmt, dither, filter_coeff, filter_size,
+                                      src_u, src_v, dst1, w);
+                    }
+                }
+            }
+        }
+        sws_freeContext(ctx);
+    }
+}
+
 void checkasm_check_sw_scale(void)
 {
     check_hscale();
@@ -368,4 +570,8 @@ void checkasm_check_sw_scale(void)
     check_yuv2yuvX(0);
     check_yuv2yuvX(1);
     report("yuv2yuvX");
+    check_input();
+    report("input");
+    check_output_p01x();
+    report("output_p01x");
 }
@@ -0,0 +1,184 @@
+/*
+ * This file is part of FFmpeg.
+ *
+ * FFmpeg is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * FFmpeg is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with FFmpeg; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <string.h>
+
+#include "libavutil/common.h"
+#include "libavutil/intreadwrite.h"
+#include "libavutil/log.h"
+#include "libavutil/mem_internal.h"
+#include "libavutil/opt.h"
+#include "libavutil/pixdesc.h"
+
+#include "libswscale/swscale.h"
+#include "libswscale/swscale_internal.h"
+
+#include "checkasm.h"
+
+#define MAX_WIDTH  130
+#define MAX_HEIGHT 6
+#define MAX_STRIDE (4 * MAX_WIDTH + 16)
+#define BUF_SIZE   (MAX_STRIDE * MAX_HEIGHT)
+
+static const int widths[] = { 2, 16, 27, 64, MAX_WIDTH };
+
+static SwsContext *alloc_unscaled_context(enum AVPixelFormat src_fmt,
+                                          enum AVPixelFormat dst_fmt,
+                                          int w, int h, int range)
+{
+    SwsContext *ctx = sws_alloc_context();
+    int log_level = av_log_get_level(), ret;
+
+    if (!ctx)
+        return NULL;
+    av_opt_set_int(ctx, "srcw", w, 0);
+    av_opt_set_int(ctx, "srch", h, 0);
+    av_opt_set_int(ctx, "dstw", w, 0);
+    av_opt_set_int(ctx, "dsth", h, 0);
+    av_opt_set_int(ctx, "src_format", src_fmt, 0);
+    av_opt_set_int(ctx, "dst_format", dst_fmt, 0);
+    av_opt_set_int(ctx, "src_range", range, 0);
+    av_opt_set_int(ctx, "dst_range", range, 0);
+    av_opt_set_int(ctx, "sws_flags", SWS_BILINEAR, 0);
+    /* Silence the warning about missing accelerated converters. */
+    av_log_set_level(AV_LOG_ERROR);
+    ret = sws_init_context(ctx, NULL, NULL);
+    av_log_set_level(log_level);
+    if (ret < 0) {
+        sws_freeContext(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static void randomize_plane(uint8_t *buf, int depth)
+{
+    if (depth > 8) {
+        for (int i = 0; i < BUF_SIZE / 2; i++)
+            AV_WN16(buf + 2 * i, rnd() & ((1 << depth) - 1));
+    } else {
+        for (int i = 0; i < BUF_SIZE; i++)
+            buf[i] = rnd();
+    }
+}
+
+static void check_convert(enum AVPixelFormat src_fmt,
+                          enum AVPixelFormat dst_fmt, int range)
+{
+    const AVPixFmtDescriptor *src_desc = av_pix_fmt_desc_get(src_fmt);
+    const AVPixFmtDescriptor *dst_desc = av_pix_fmt_desc_get(dst_fmt);
+    LOCAL_ALIGNED_16(uint8_t, src_buf, [4 * BUF_SIZE]);
+    LOCAL_ALIGNED_16(uint8_t, dst0_buf, [4 * BUF_SIZE]);
+    LOCAL_ALIGNED_16(uint8_t, dst1_buf, [4 * BUF_SIZE]);
+    int nb_planes = av_pix_fmt_count_planes(dst_fmt);
+
+    declare_func(int, SwsContext *c, const uint8_t *src[], int srcStride[],
+                 int srcSliceY, int srcSliceH, uint8_t *dst[],
+                 int dstStride[]);
+
+    for (int p = 0; p < 4; p++)
+        randomize_plane(src_buf + p * BUF_SIZE, src_desc->comp[0].depth);
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(widths); i++) {
+        int w = widths[i];
+        SwsContext *ctx = alloc_unscaled_context(src_fmt, dst_fmt, w,
+                                                 MAX_HEIGHT, range);
+
+        if (!ctx) {
+            fail();
+            return;
+        }
+        if (ctx->convert_unscaled &&
+            check_func(ctx->convert_unscaled, "%s_%s%s_%d", src_desc->name,
+                       dst_desc->name, range ? "_full" : "", w)) {
+            const uint8_t *src[4] = { NULL };
+            uint8_t *dst0[4] = { NULL }, *dst1[4] = { NULL };
+            int src_stride[4], dst_stride[4];
+
+            for (int p = 0; p < 4; p++) {
+                if (p < av_pix_fmt_count_planes(src_fmt))
+                    src[p] = src_buf + p * BUF_SIZE;
+                if (p < nb_planes) {
+                    dst0[p] = dst0_buf + p * BUF_SIZE;
+                    dst1[p] = dst1_buf + p * BUF_SIZE;
+                }
+            }
+            memset(dst0_buf, 0, 4 * BUF_SIZE);
+            memset(dst1_buf, 0, 4 * BUF_SIZE);
+
+            /* The C converters may modify the strides, so reset them. */
+#define RESET_STRIDES()                                   \
+            for (int p = 0; p < 4; p++) {                 \
+                src_stride[p] = MAX_STRIDE;               \
+                dst_stride[p] = MAX_STRIDE;               \
+            }
+            RESET_STRIDES();
+            call_ref(ctx, src, src_stride, 0, MAX_HEIGHT, dst0, dst_stride);
+            RESET_STRIDES();
+            call_new(ctx, src, src_stride, 0, MAX_HEIGHT, dst1, dst_stride);
+
+            if (memcmp(dst0_buf, dst1_buf, 4 * BUF_SIZE))
+                fail();
+
+            RESET_STRIDES();
+            bench_new(ctx, src, src_stride, 0, MAX_HEIGHT, dst1, dst_stride);
+#undef RESET_STRIDES
+        }
+        sws_freeContext(ctx);
+    }
+}
+
+static void check_yuv2rgb(void)
+{
+    static const enum AVPixelFormat src_fmts[] = {
+        AV_PIX_FMT_YUV420P, AV_PIX_FMT_YUV422P,
+    };
+    static const enum AVPixelFormat dst_fmts[] = {
+        AV_PIX_FMT_ARGB, AV_PIX_FMT_ABGR, AV_PIX_FMT_RGBA, AV_PIX_FMT_BGRA,
+        AV_PIX_FMT_RGB24, AV_PIX_FMT_BGR24,
+    };
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(src_fmts); i++)
+        for (int j = 0; j < FF_ARRAY_ELEMS(dst_fmts); j++)
+            check_convert(src_fmts[i], dst_fmts[j], 0);
+}
+
+static void check_planar_copy(void)
+{
+    static const enum AVPixelFormat fmts[][2] = {
+        { AV_PIX_FMT_YUV420P,     AV_PIX_FMT_YUV420P10LE },
+        { AV_PIX_FMT_YUV420P,     AV_PIX_FMT_YUV420P16LE },
+        { AV_PIX_FMT_YUV444P,     AV_PIX_FMT_YUV444P12LE },
+        { AV_PIX_FMT_YUVA420P,    AV_PIX_FMT_YUVA420P10LE },
+        { AV_PIX_FMT_YUV420P10LE, AV_PIX_FMT_YUV420P12LE },
+        { AV_PIX_FMT_YUV422P10LE, AV_PIX_FMT_YUV422P16LE },
+    };
+
+    for (int i = 0; i < FF_ARRAY_ELEMS(fmts); i++)
+        for (int range = 0; range < 2; range++)
+            check_convert(fmts[i][0], fmts[i][1], range);
+}
+
+void checkasm_check_sw_unscaled(void)
+{
+    check_yuv2rgb();
+    report("yuv2rgb");
+
+    check_planar_copy();
+    report("planar_copy");
+}
@@ -21,6 +21,9 @@
 #include "checkasm.h"
 #include "libavfilter/vf_nlmeans_init.h"
 #include "libavutil/avassert.h"
+#include "libavutil/mem_internal.h"
+
+#define W_LINE 256
 
 #define randomize_buffer(buf, size) do {    \
     int i;                                  \
@@ -109,5 +112,57 @@ void checkasm_check_nlmeans(void)
         av_freep(&src);
     }
 
+    if (check_func(dsp.compute_weights_line, "weights_line")) {
+        const int max_meaningful_diff = 255;
+        LOCAL_ALIGNED_32(uint32_t, iia, [W_LINE]);
+        LOCAL_ALIGNED_32(uint32_t, iib, [W_LINE]);
+        LOCAL_ALIGNED_32(uint32_t, iid, [W_LINE]);
+        LOCAL_ALIGNED_32(uint32_t, iie, [W_LINE]);
+        LOCAL_ALIGNED_32(uint8_t,  src, [W_LINE]);
+        LOCAL_ALIGNED_32(float, total_weight_ref, [W_LINE]);
+        LOCAL_ALIGNED_32(float, total_weight_new, [W_LINE]);
+        LOCAL_ALIGNED_32(float, sum_ref, [W_LINE]);
+        LOCAL_ALIGNED_32(float, sum_new, [W_LINE]);
+        LOCAL_ALIGNED_32(float, weight_lut, [256]);
+
+        declare_func(void, const uint32_t *const iia,
+                     const uint32_t *const iib,
+                     const uint32_t *const iid,
+                     const uint32_t *const iie,
+                     const uint8_t *const src,
+                     float *total_weight,
+                     float *sum,
+                     const float *const weight_lut,
+                     int max_meaningful_diff,
+                     int startx, int endx);
+
+        for (int i = 0; i < W_LINE; i++) {
+            iia[i] = rnd();
+            iib[i] = rnd();
+            iid[i] = rnd();
+            /* Patch differences both below and above the clipping point */
+            iie[i] = iid[i] + iib[i] - iia[i] + rnd() % (2 * max_meaningful_diff);
+            src[i] = rnd();
+            total_weight_ref[i] = total_weight_new[i] = (rnd() & 0xffff) / 256.0f;
+            sum_ref[i] = sum_new[i] = (rnd() & 0xffffff) / 256.0f;
+        }
+        for (int i = 0; i <= max_meaningful_diff; i++)
+            weight_lut[i] = (rnd() & 0xffff) / 65536.0f;
+
+        for (int startx = 0; startx < 3; startx++) {
+            int endx = W_LINE - (rnd() & 0xf);
+
+            call_ref(iia, iib, iid, iie, src, total_weight_ref, sum_ref,
+                     weight_lut, max_meaningful_diff, startx, endx);
+            call_new(iia, iib, iid, iie, src, total_weight_new, sum_new,
+                     weight_lut, max_meaningful_diff, startx, endx);
+            if (memcmp(total_weight_ref, total_weight_new, W_LINE * sizeof(float)) ||
+                memcmp(sum_ref, sum_new, W_LINE * sizeof(float)))
+                fail();
+        }
+        bench_new(iia, iib, iid, iie, src, total_weight_new, sum_new,
+                  weight_lut, max_meaningful_diff, 0, W_LINE);
+    }
+
     report("dsp");
 }
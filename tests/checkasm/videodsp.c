@@ -86,5 +86,9 @@ void checkasm_check_videodsp(void)
     if (check_func(vdsp.emulated_edge_mc, "emulated_edge_mc_8"))
         check_emu_edge(uint8_t);
 
+    ff_videodsp_init(&vdsp, 16);
+    if (check_func(vdsp.emulated_edge_mc, "emulated_edge_mc_16"))
+        check_emu_edge(uint16_t);
+
     report("emulated_edge_mc");
 }
@@ -322,6 +322,146 @@ static void check_avg(void)
     report("avg");
 }
 
+#define ALF_SRC_STRIDE   (MAX_CTU_SIZE + 2 * ALF_PADDING_SIZE)
+#define ALF_SRC_BUF_SIZE (ALF_SRC_STRIDE * ALF_SRC_STRIDE * 2)
+#define ALF_SRC_OFFSET   ((ALF_PADDING_SIZE * ALF_SRC_STRIDE + ALF_PADDING_SIZE) * SIZEOF_PIXEL)
+#define ALF_PARAMS_SIZE  (MAX_CTU_SIZE * MAX_CTU_SIZE / ALF_BLOCK_SIZE / ALF_BLOCK_SIZE * ALF_NUM_COEFF_LUMA)
+
+static void check_alf_filter(void)
+{
+    LOCAL_ALIGNED_32(uint8_t, dst0, [DST_BUF_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, dst1, [DST_BUF_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, src0, [ALF_SRC_BUF_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, src1, [ALF_SRC_BUF_SIZE]);
+    int16_t filter[ALF_PARAMS_SIZE];
+    int16_t clip[ALF_PARAMS_SIZE];
+    VVCDSPContext c;
+
+    declare_func(void, uint8_t *dst, ptrdiff_t dst_stride, const uint8_t *src, ptrdiff_t src_stride,
+        int width, int height, const int16_t *filter, const int16_t *clip, int vb_pos);
+
+    for (int bit_depth = 8; bit_depth <= 12; bit_depth += 2) {
+        static const int clip_shift[] = { 0, 3, 5, 7 };
+        const ptrdiff_t src_stride = ALF_SRC_STRIDE * SIZEOF_PIXEL;
+
+        ff_vvc_dsp_init(&c, bit_depth);
+        randomize_pixels(src0, src1, ALF_SRC_BUF_SIZE);
+        for (int i = 0; i < ALF_PARAMS_SIZE; i++) {
+            filter[i] = rnd() % 256 - 128;
+            clip[i]   = 1 << (bit_depth - clip_shift[rnd() % 4]);
+        }
+        for (int c_idx = LUMA; c_idx <= CHROMA; c_idx++) {
+            const int vb_above = c_idx == LUMA ? ALF_VB_POS_ABOVE_LUMA : ALF_VB_POS_ABOVE_CHROMA;
+            for (int h = 4; h <= MAX_CTU_SIZE; h *= 2) {
+                for (int w = 4; w <= MAX_CTU_SIZE; w *= 2) {
+                    const int vb_pos = h - vb_above;
+                    if (check_func(c.alf.filter[c_idx], "alf_filter_%s_%d_%dx%d",
+                                   c_idx == LUMA ? "luma" : "chroma", bit_depth, w, h)) {
+                        memset(dst0, 0, DST_BUF_SIZE);
+                        memset(dst1, 0, DST_BUF_SIZE);
+                        call_ref(dst0, PIXEL_STRIDE, src0 + ALF_SRC_OFFSET, src_stride, w, h, filter, clip, vb_pos);
+                        call_new(dst1, PIXEL_STRIDE, src1 + ALF_SRC_OFFSET, src_stride, w, h, filter, clip, vb_pos);
+                        if (memcmp(dst0, dst1, DST_BUF_SIZE))
+                            fail();
+                        if (w == h)
+                            bench_new(dst1, PIXEL_STRIDE, src1 + ALF_SRC_OFFSET, src_stride, w, h, filter, clip, vb_pos);
+                    }
+                }
+            }
+        }
+    }
+    report("alf_filter");
+}
+
+#define ITX_BUF_SIZE (64 * 64)
+
+static void check_itx(void)
+{
+    static const char *const tx_type_names[N_TX_TYPE] = { "dct2", "dst7", "dct8" };
+    LOCAL_ALIGNED_32(int, coeffs0, [ITX_BUF_SIZE]);
+    LOCAL_ALIGNED_32(int, coeffs1, [ITX_BUF_SIZE]);
+    VVCDSPContext c;
+
+    declare_func(void, int *coeffs, ptrdiff_t step, size_t nz);
+
+    for (int bit_depth = 8; bit_depth <= 12; bit_depth += 2) {
+        ff_vvc_dsp_init(&c, bit_depth);
+        for (int type = DCT2; type < N_TX_TYPE; type++) {
+            const int min_log2 = type == DCT2 ? 1 : 2;
+            const int max_log2 = type == DCT2 ? 6 : 5;
+            for (int log2_size = min_log2; log2_size <= max_log2; log2_size++) {
+                const int size   = 1 << log2_size;
+                const int max_nz = type == DCT2 ? FFMIN(size, 32) : FFMIN(size, 16);
+                const ptrdiff_t step = size;
+
+                if (check_func(c.itx.itx[type][log2_size - 1], "itx_%s_%d_%d",
+                               tx_type_names[type], size, bit_depth)) {
+                    for (int nz = 1; nz <= max_nz; nz *= 2) {
+                        memset(coeffs0, 0, sizeof(*coeffs0) * ITX_BUF_SIZE);
+                        for (int i = 0; i < nz; i++)
+                            coeffs0[i * step] = (int16_t)rnd();
+                        memcpy(coeffs1, coeffs0, sizeof(*coeffs0) * ITX_BUF_SIZE);
+                        call_ref(coeffs0, step, nz);
+                        call_new(coeffs1, step, nz);
+                        if (memcmp(coeffs0, coeffs1, sizeof(*coeffs0) * ITX_BUF_SIZE))
+                            fail();
+                    }
+                    bench_new(coeffs1, 1, max_nz);
+                }
+            }
+        }
+    }
+    report("itx");
+}
+
+static void check_add_residual(void)
+{
+    LOCAL_ALIGNED_32(int, res, [MAX_CTU_SIZE * MAX_CTU_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, dst0, [DST_BUF_SIZE]);
+    LOCAL_ALIGNED_32(uint8_t, dst1, [DST_BUF_SIZE]);
+    VVCDSPContext c;
+
+    for (int bit_depth = 8; bit_depth <= 12; bit_depth += 2) {
+        const int range = 1 << (bit_depth + 2);
+
+        ff_vvc_dsp_init(&c, bit_depth);
+        for (int i = 0; i < MAX_CTU_SIZE * MAX_CTU_SIZE; i++)
+            res[i] = rnd() % (2 * range) - range;
+        for (int h = 4; h <= 64; h *= 2) {
+            for (int w = 4; w <= 64; w *= 2) {
+                {
+                    declare_func(void, uint8_t *dst, const int *res, int width, int height, ptrdiff_t stride);
+                    if (check_func(c.itx.add_residual, "add_residual_%d_%dx%d", bit_depth, w, h)) {
+                        randomize_pixels(dst0, dst1, DST_BUF_SIZE);
+                        call_ref(dst0, res, w, h, PIXEL_STRIDE);
+                        call_new(dst1, res, w, h, PIXEL_STRIDE);
+                        if (memcmp(dst0, dst1, DST_BUF_SIZE))
+                            fail();
+                        if (w == h)
+                            bench_new(dst1, res, w, h, PIXEL_STRIDE);
+                    }
+                }
+                {
+                    declare_func(void, uint8_t *dst, const int *res, int width, int height, ptrdiff_t stride,
+                        int c_sign, int shift);
+                    const int c_sign = rnd() & 1 ? 1 : -1;
+                    const int shift  = rnd() & 1;
+                    if (check_func(c.itx.add_residual_joint, "add_residual_joint_%d_%dx%d", bit_depth, w, h)) {
+                        randomize_pixels(dst0, dst1, DST_BUF_SIZE);
+                        call_ref(dst0, res, w, h, PIXEL_STRIDE, c_sign, shift);
+                        call_new(dst1, res, w, h, PIXEL_STRIDE, c_sign, shift);
+                        if (memcmp(dst0, dst1, DST_BUF_SIZE))
+                            fail();
+                        if (w == h)
+                            bench_new(dst1, res, w, h, PIXEL_STRIDE, c_sign, shift);
+                    }
+                }
+            }
+        }
+    }
+    report("add_residual");
+}
+
 void checkasm_check_vvc_mc(void)
 {
     check_put_vvc_luma();
@@ -329,4 +469,7 @@ void checkasm_check_vvc_mc(void)
     check_put_vvc_chroma();
     check_put_vvc_chroma_uni();
     check_avg();
+    check_alf_filter();
+    check_itx();
+    check_add_residual();
 }